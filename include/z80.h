@@ -32,31 +32,169 @@ using namespace emscripten;
 typedef unsigned char ZBYTE;
 typedef unsigned short ZWORD;
 typedef unsigned long ZDWORD;
+typedef unsigned long long ZQWORD;
 
 typedef ZBYTE Z80ADDRESSBUS[0xffff + 1];
 
+// Every write by the CPU flags its 256 byte page, see TakeDirtyPages()
+#define MARKDIRTY(addr) dirty[(ZWORD) (addr) >> 14] |= 1ULL << (((ZWORD) (addr) >> 8) & 63)
+
 #ifdef __Z80MEMCALLBACKS__
+#define MEMREAD(addr) MemReadCallback(addr)
+#define MEMWRITE(addr, val) \
+{ \
+	MemWriteCallback(addr, val); \
+	MARKDIRTY(addr); \
+}
+#else
+#define MEMREAD(addr) memory[(ZWORD) (addr)]
+#define MEMWRITE(addr, val) \
+{ \
+	memory[(ZWORD) (addr)] = val; \
+	MARKDIRTY(addr); \
+}
+#endif
+
+// Reads the core does for its own bookkeeping, never reported to the bus
+#define PEEKBYTE(addr) MEMREAD(addr)
+
+#if defined(__Z80BUSTIMING__)
+
+#define OPCODE(addr) BusFetch(addr)
+#define READBYTE(addr) BusRead(addr)
+#define WRITEBYTE(addr, val) BusWrite(addr, val)
+#define READWORD(addr) ReadWord(addr)
+#define WRITEWORD(addr, val) WriteWord(addr, val)
+
+// Stack pushes put the high byte out first, as the CPU does
+#define PUSHWORD(addr, val) \
+{ \
+	WRITEBYTE((addr) + 1, (val) >> 8); \
+	WRITEBYTE(addr, val); \
+}
+
+#elif defined(__Z80MEMCALLBACKS__)
 
 #define OPCODE(addr) MemReadCallback(addr)
 #define READBYTE(addr) MemReadCallback(addr)
-#define WRITEBYTE(addr, val) MemWriteCallback(addr, val)
+#define WRITEBYTE(addr, val) MEMWRITE(addr, val)
 #define READWORD(addr) ReadWord(addr)
 #define WRITEWORD(addr, val) WriteWord(addr, val)
 
 #else
 
-#define OPCODE(addr) memory[addr]
-#define READBYTE(addr) memory[addr]
-#define WRITEBYTE(addr, val) memory[addr] = val
-#define READWORD(addr) ((memory[addr + 1] << 8) | memory[addr])
+// Addresses wrap at 64 KB, (IX+d) and word accesses at FFFF included
+#define OPCODE(addr) memory[(ZWORD) (addr)]
+#define READBYTE(addr) memory[(ZWORD) (addr)]
+#define WRITEBYTE(addr, val) MEMWRITE(addr, val)
+#define READWORD(addr) ((memory[(ZWORD) ((addr) + 1)] << 8) | memory[(ZWORD) (addr)])
 #define WRITEWORD(addr, val) \
 { \
-	memory[addr] = val; \
-	memory[addr + 1] = val >> 8; \
+	memory[(ZWORD) (addr)] = val; \
+	memory[(ZWORD) ((addr) + 1)] = (val) >> 8; \
+	MARKDIRTY(addr); \
+	MARKDIRTY((addr) + 1); \
 }
 
 #endif
 
+#ifndef PUSHWORD
+#define PUSHWORD(addr, val) WRITEWORD(addr, val)
+#endif
+
+
+// Bus cycle types reported in __Z80BUSTIMING__ builds
+#define Z80BUS_FETCH	0
+#define Z80BUS_READ		1
+#define Z80BUS_WRITE	2
+#define Z80BUS_IOREAD	3
+#define Z80BUS_IOWRITE	4
+#define Z80BUS_INTACK	5		// INT acknowledge, data is the byte read off the bus
+
+
+// Pending events word. Run() only leaves the straight decode path when it's non zero.
+#define Z80EVENT_NMI	0x01		// NMI edge latched
+#define Z80EVENT_INT	0x02		// INT line asserted
+#define Z80EVENT_EI		0x04		// Previous instruction was EI, INT is not sampled
+#define Z80EVENT_HALT	0x08		// Executing NOPs until an interrupt
+#define Z80EVENT_STALL	0x10		// WAIT / BUSREQ T-states due before the next instruction
+#define Z80EVENT_IOWAIT	0x20		// Suspended before an IN, see SetIOReadAsyncCallback()
+
+
+#define Z80IRQ_BUCKETS	16		// Histograms, bucket n counts values < 2^n T-states
+#define Z80IRQ_NESTING	16		// Deepest nesting tracked for service times
+
+
+// Interrupt instrumentation, see SetIRQStats(). Plain data, copy it out to
+// export it.
+typedef struct {
+	ZQWORD requests;				// INT assertions
+	ZQWORD accepted;				// INT acknowledges
+	ZQWORD nmis;
+	ZQWORD missed;					// Requests released or repeated while IFF1 was 0
+
+	ZQWORD latency_total;			// Request to acknowledge, T-states
+	ZQWORD latency_max;
+	ZQWORD latency[Z80IRQ_BUCKETS];
+
+	ZQWORD services;				// Handlers that returned
+	ZQWORD service_total;			// Acknowledge to the return that pops the frame, T-states
+	ZQWORD service_max;
+	ZQWORD service[Z80IRQ_BUCKETS];
+
+	unsigned int depth;				// Handlers currently running, up to Z80IRQ_NESTING
+	unsigned int max_depth;
+	ZQWORD untracked;				// Entries nested deeper than that, not timed
+
+	// Bookkeeping
+	unsigned int pending;
+	ZQWORD pending_since;
+	ZQWORD entry_clock[Z80IRQ_NESTING];
+	ZWORD entry_sp[Z80IRQ_NESTING];
+} Z80IRQSTATS;
+
+
+#define Z80STATE_MAGIC		0x5430385a	// "Z80T"
+#define Z80STATE_VERSION	1
+
+
+// Everything SaveState() captures: registers, decode progress of the
+// instruction in flight, pending events, counters and the 64 KB address
+// space. Plain words and no padding, host byte order.
+typedef struct {
+	unsigned int magic;
+	unsigned int version;
+	unsigned int size;				// sizeof(Z80STATE)
+	unsigned int events;			// Z80EVENT_*
+
+	ZWORD af, bc, de, hl;
+	ZWORD alt_af, alt_bc, alt_de, alt_hl;
+	ZWORD ix, iy, sp, pc, ir, wz;
+	ZBYTE iff1, iff2, im, op;
+	ZBYTE i_set, io_ready, io_value, irq_data;
+	ZWORD instruction;				// Table * 256 + index of the decoded instruction
+	ZWORD irq_vector;				// Address after an IM 0 CALL / JP
+
+	int tstates_counter;			// T-states left of the instruction in flight
+	int mcycles_counter;
+	int last_mcycle_tstates;
+	int will_jump;
+	unsigned int stall;
+	unsigned int ioreq;
+
+	ZQWORD clock;
+	ZQWORD io_count;
+	ZQWORD bus_start;				// __Z80BUSTIMING__ builds only, 0 otherwise
+	unsigned int bus_offset;
+	unsigned int bus_gaps;
+
+	Z80ADDRESSBUS memory;
+} Z80STATE;
+
+
+class Z80SharedState;
+class Z80IOLog;
+class Z80Recorder;
 
 
 class Z80 {
@@ -64,6 +202,9 @@ class Z80 {
 #ifdef __Z80TEST__
 friend class Z80Test;
 #endif
+friend class Z80SharedState;
+friend class Z80Batch;
+friend class Z80RunAhead;
 
 public:
 
@@ -71,6 +212,55 @@ public:
 	ZBYTE *memory;   	// Pointer to Z80ADDRESSBUS
 
 
+private:
+
+	typedef union {
+
+		struct {
+			ZWORD af, bc, de, hl, ix, iy, sp, ir, wz; // WZ is an undocumented internal register (also known as MEMPTR)
+		} w;
+
+		struct {
+			#ifndef _Z80_BIG_ENDIAN_
+			ZBYTE f, a, c, b, e, d, l, h, ixl, ixh, iyl, iyh, p, s, r, i, z, w;
+			#else
+			ZBYTE a, f, b, c, d, e, h, l, ixh, ixl, iyh, iyl, s, p, i, r, w, z;
+			#endif
+		} b;
+
+		ZWORD pairs[9];
+		ZBYTE registers[18];
+	} Z80REGISTERS;
+
+	// State touched by every instruction comes first, so that with memory it
+	// fills the first two cache lines of the object
+
+	Z80REGISTERS reg = {};
+	ZWORD pc;
+	unsigned int events = 0;	// Z80EVENT_* bits
+
+	unsigned int tstates;
+	int tstates_counter = 0;
+	int mcycles_counter = 0;
+	int last_mcycle_tstates = 0;
+	void (Z80::*current_instruction)() = &Z80::NOP;
+
+	ZQWORD clock = 0;		// T-states since construction, never reset
+	ZBYTE op = 0;
+	bool executing = false;		// Inside ExecuteTStates() / ExecuteMCycle(), tstates not in clock yet
+	int i_set = 0;
+	int will_jump = 0;
+
+	Z80REGISTERS alt_reg = {};
+	unsigned int iff1;
+	unsigned int iff2;
+	unsigned int im;
+	unsigned int stall = 0;		// WAIT / BUSREQ T-states, see Z80EVENT_STALL
+	ZQWORD dirty[4] = {};		// Pages written, bit n of word n / 64 for page n
+	ZQWORD published[4] = {};	// Dirty pages a Z80SharedState copied out, not taken yet
+
+
+public:
 
 	Z80();
 	~Z80();
@@ -78,32 +268,74 @@ public:
 	unsigned int ExecuteInstruction();
 	unsigned int ExecuteTStates(unsigned int ts);
 	unsigned int ExecuteMCycle();
+	unsigned int ExecuteFrame(unsigned int ts, Z80IOLog *log);
 
 	void NMI();
-	void IRQ0();
-	void IRQ1();
-	void IRQ2(ZBYTE vector);
+	void IRQ(ZBYTE data = 0xff, ZWORD address = 0);
+	void ClearIRQ();
+
+	void SetIRQStats(Z80IRQSTATS *stats);
+	void SetRecorder(Z80Recorder *rec);
+
+	void Wait(unsigned int ts);
+	void BusRequest(unsigned int ts);
 
 	unsigned int isHalted();
+	bool isWaiting();
+	bool isSuspended();
+
+	void ResumeIO(ZBYTE val);
+
+	ZQWORD GetClock();
+	ZQWORD GetIOCount();
 
 	void Reset();
 
+	void SaveState(Z80STATE *state, bool with_memory = true);
+	int LoadState(const Z80STATE *state, bool with_memory = true);
+	void TakeDirtyPages(ZQWORD pages[4]);
+	void MarkDirty(ZWORD addr, unsigned int len);
+
 	void SetIOReadCallback(std::function<ZBYTE(ZWORD)> cb);
 	void SetIOWriteCallback(std::function<void(ZWORD, ZBYTE)> cb);
+	void SetIOReadAsyncCallback(std::function<bool(ZWORD, ZBYTE &)> cb);
+	void SetIRQAckCallback(std::function<ZBYTE()> cb);
+	void SetRETICallback(std::function<void()> cb);
 	#ifdef __Z80MEMCALLBACKS__
 	void SetMemReadCallback(std::function<ZBYTE(ZWORD)> cb);
 	void SetMemWriteCallback(std::function<void(ZWORD, ZBYTE)> cb);
 	#endif
+	#ifdef __Z80BUSTIMING__
+	void SetBusCallback(std::function<void(ZQWORD, ZBYTE, ZWORD, ZBYTE)> cb);
+	#endif
 	
 	
 private:
 
 	std::function<ZBYTE(ZWORD)> IOReadCallback;
 	std::function<void(ZWORD, ZBYTE)> IOWriteCallback;
+	std::function<bool(ZWORD, ZBYTE &)> IOReadAsyncCallback;
 
 	std::function<ZBYTE(ZWORD)> MemReadCallback;
 	std::function<void(ZWORD, ZBYTE)> MemWriteCallback;
 
+	std::function<ZBYTE()> IRQAckCallback;
+	std::function<void()> RETICallback;
+
+#ifdef __Z80BUSTIMING__
+	std::function<void(ZQWORD, ZBYTE, ZWORD, ZBYTE)> BusCallback;
+
+	ZQWORD bus_start = 0;		// Clock at the first T-state of the current instruction
+	unsigned int bus_offset = 0;	// T-state of the next bus cycle within it
+	ZWORD bus_gaps = 0;			// Internal T-states before the next body accesses, see bus_gap_table
+#endif
+
+	Z80SharedState *shared = nullptr;	// Published at the end of every ExecuteXXX() call if set
+	Z80IRQSTATS *irqstats = nullptr;	// Null when instrumentation is off
+	Z80IOLog *iolog = nullptr;		// Only set during ExecuteFrame()
+	Z80Recorder *recorder = nullptr;	// Gets INs, acceptances and stalls if set
+
+	void CB_Exec();
 	void ED_Exec();
 	void FD_Exec();
 	void DD_Exec();
@@ -111,28 +343,11 @@ private:
 	typedef void (Z80::*OPCODES)();
 	
 	int ioreq = 0;
+	ZQWORD io_count = 0;		// IN and OUT bus cycles since construction
 
-	unsigned int halted;
-	bool nmi; 			// Non-maskable interruption
-	bool irq; 			// Maskable interruption
-
-	typedef union {
-
-		struct {
-			ZWORD af, bc, de, hl, ix, iy, sp, ir, wz; // WZ is an undocumented internal register (also known as MEMPTR)
-		} w;
-
-		struct {
-			#ifndef _Z80_BIG_ENDIAN_
-			ZBYTE f, a, c, b, e, d, l, h, ixl, ixh, iyl, iyh, p, s, r, i, z, w;
-			#else
-			ZBYTE a, f, b, c, d, e, h, l, ixh, ixl, iyh, iyl, s, p, i, r, w, z;
-			#endif
-		} b;
-
-		ZWORD pairs[9];
-		ZBYTE registers[18];
-	} Z80REGISTERS;
+	bool async_io = false;		// IOReadAsyncCallback set
+	bool io_ready = false;		// io_value is what the next IN reads
+	ZBYTE io_value = 0xff;
 
 
 	typedef struct {
@@ -153,65 +368,39 @@ private:
 	typedef ARGUMENTS ARGUMENT_SETS[256];
 
 
-	Z80REGISTERS reg, alt_reg;
+	ZBYTE irq_data = 0xff;		// Byte on the data bus during the INT acknowledge
+	ZWORD irq_vector = 0;		// Operand of an IM 0 CALL / JP
+	int ack_byte = 0;			// Bytes read so far in the acknowledge
 
-	ZWORD pc;
-
-	unsigned int iff1;
-	unsigned int iff2;
-	unsigned int im;
-
-	unsigned int tstates;
-
-	ZBYTE defer_irq;
-
-	ZBYTE irq_vector;
-
-	int const parity[256] = {
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
-		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1 };
-
-
-
-	ZBYTE op;
-	int i_set = 0;
-
-	int mcycles_counter = 0;
-
-	int tstates_counter = 0;
-
-	int will_jump = 0;
-	int last_mcycle_tstates = 0;
-	void (Z80::*current_instruction)();
 
 
 	void NonMaskableInterrupt();
 	void MaskableInterrupt();
 	inline void Run();
+	bool Events();
+	bool AsyncIN(ZWORD port, ZWORD start);
+	void AcceptNMI();
+	void AcceptIRQ();
+	void Wake();
+	void IRQEntry();
+	void IRQReturn();
+	static int Bucket(ZQWORD ts);
 
 
-	void CorrectEndianess();
 
-#ifdef __Z80MEMCALLBACKS__	
+#if defined(__Z80MEMCALLBACKS__) || defined(__Z80BUSTIMING__)
 	ZWORD ReadWord(ZWORD addr);
 
 	void WriteWord(ZWORD addr, ZWORD val);
 #endif
 
+#ifdef __Z80BUSTIMING__
+	ZBYTE BusFetch(ZWORD addr);
+	ZBYTE BusRead(ZWORD addr);
+	void BusWrite(ZWORD addr, ZBYTE val);
+	void BusPlaceholder(ZQWORD tstate, ZBYTE type, ZWORD addr, ZBYTE data);
+#endif
+
 	ZBYTE ReadIO(ZWORD addr);
 
 	void WriteIO(ZWORD addr, ZBYTE val);
@@ -221,630 +410,36 @@ private:
 
 	ZBYTE IOReadPlaceholder(ZWORD addr);
 	void IOWritePlaceholder(ZWORD addr, ZBYTE data);
+	ZBYTE IRQAckPlaceholder();
+	void RETIPlaceholder();
 
 #ifdef __Z80MEMCALLBACKS__
 	ZBYTE MemReadPlaceholder(ZWORD addr);
 	void MemWritePlaceholder(ZWORD addr, ZBYTE data);
 #endif
 
-	const ZBYTE SZ_table[256] = {
-
-		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 
-		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 
-		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 
-		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 
-		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 
-		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 
-		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 
-		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8	};
-
-
-	const ZBYTE SZP_table[256] = {
-
-		0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 
-		0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c, 
-		0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 
-		0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08, 
-		0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 
-		0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28, 
-		0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 
-		0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c, 
-		0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 
-		0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08, 
-		0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 
-		0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c, 
-		0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 
-		0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c, 
-		0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 
-		0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28, 
-		0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 
-		0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88, 
-		0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 
-		0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c, 
-		0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0, 
-		0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac, 
-		0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4, 
-		0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8, 
-		0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 
-		0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c, 
-		0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 
-		0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88, 
-		0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4, 
-		0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8, 
-		0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0, 
-		0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac };
-
-	const int V_table[4] = { 0, 4, 4, 0, };
-	
-	const OPCODES main_instructions[256] = {
-		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
-		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
-		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
-		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_ind,&Z80::DEC_ind,&Z80::LD_ind_n,&Z80::SCF,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::HALT,&Z80::LD_ind_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
-		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_HL,&Z80::ADD_R_R,
-		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_HL,&Z80::ADC_R_R,
-		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_HL,&Z80::SUB_R,
-		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_HL,&Z80::SBC_R_R,
-		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_HL,&Z80::AND_R,
-		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_HL,&Z80::XOR_R,
-		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_HL,&Z80::OR_R,
-		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_HL,&Z80::CP_R,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
-
-
-	const OPCODES cb_instructions[256] = {
-		&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_HL,&Z80::RLC_R,
-		&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_HL,&Z80::RRC_R,
-		&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_HL,&Z80::RL_R,
-		&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_HL,&Z80::RR_R,
-		&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_HL,&Z80::SLA_R,
-		&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_HL,&Z80::SRA_R,
-		&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_HL,&Z80::SLL_R,
-		&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_HL,&Z80::SRL_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
-		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R };
-
-
-	const OPCODES ed_instructions[256] = {
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::LD_R_R,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::LD_R_R,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::LD_R_spec,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::LD_R_spec,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::RRD,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::RLD,
-		&Z80::IN_R_c,&Z80::OUT_c_0,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::NOP,
-		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::LDI,&Z80::CPI,&Z80::INI,&Z80::OUTI,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::LDD,&Z80::CPD,&Z80::IND,&Z80::OUTD,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::LDIR,&Z80::CPIR,&Z80::INIR,&Z80::OTIR,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::LDDR,&Z80::CPDR,&Z80::INDR,&Z80::OTDR,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
-		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP };
-
-
-	const OPCODES dd_instructions[256] = {
-		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
-		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
-		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
-		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_off,&Z80::DEC_off,&Z80::LD_off_n,&Z80::SCF,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::HALT,&Z80::LD_off_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_off,&Z80::ADD_R_R,
-		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_off,&Z80::ADC_R_R,
-		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_off,&Z80::SUB_R,
-		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_off,&Z80::SBC_R_R,
-		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_off,&Z80::AND_R,
-		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_off,&Z80::XOR_R,
-		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_off,&Z80::OR_R,
-		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_off,&Z80::CP_R,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
-
-
-	const OPCODES fd_instructions[256] = {
-		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
-		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
-		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
-		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
-		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_off,&Z80::DEC_off,&Z80::LD_off_n,&Z80::SCF,
-		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::HALT,&Z80::LD_off_R,
-		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
-		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_off,&Z80::ADD_R_R,
-		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_off,&Z80::ADC_R_R,
-		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_off,&Z80::SUB_R,
-		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_off,&Z80::SBC_R_R,
-		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_off,&Z80::AND_R,
-		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_off,&Z80::XOR_R,
-		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_off,&Z80::OR_R,
-		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_off,&Z80::CP_R,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
-		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
-
-
-	const OPCODES ddcb_instructions[256] = {
-		&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off,&Z80::RLC_off_R,
-		&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off,&Z80::RRC_off_R,
-		&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off,&Z80::RL_off_R,
-		&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off,&Z80::RR_off_R,
-		&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off,&Z80::SLA_off_R,
-		&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off,&Z80::SRA_off_R,
-		&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off,&Z80::SLL_off_R,
-		&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off,&Z80::SRL_off_R,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R };
-
-
-	const OPCODES fdcb_instructions[256] = {
-		&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off,&Z80::RLC_off_R,
-		&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off,&Z80::RRC_off_R,
-		&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off,&Z80::RL_off_R,
-		&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off,&Z80::RR_off_R,
-		&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off,&Z80::SLA_off_R,
-		&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off,&Z80::SRA_off_R,
-		&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off,&Z80::SLL_off_R,
-		&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off,&Z80::SRL_off_R,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
-		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R };
-
-
-
-
-
-
-ARGUMENT_SETS a_set[7] = {
-		{ {0,0,0,4,1,4,1,4,4,0},{1,0,0,10,3,10,3,2,2,0},{1,0,0,7,2,7,2,3,3,0},{1,0,0,6,2,6,2,2,2,0},{2,0,0,4,1,4,1,4,4,0},{2,0,0,4,1,4,1,4,4,0},{2,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{3,1,0,11,3,11,3,3,3,0},{0,1,0,7,2,7,2,3,3,0},{1,0,0,6,2,6,2,2,2,0},{3,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,13,3,8,2,5,4,2},{2,0,0,10,3,10,3,2,2,0},{2,0,0,7,2,7,2,3,3,0},{2,0,0,6,2,6,2,2,2,0},{4,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{4,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,12,3,12,3,4,4,0},{3,2,0,11,3,11,3,3,3,0},{0,2,0,7,2,7,2,3,3,0},{2,0,0,6,2,6,2,2,2,0},{5,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{5,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{1,0,0,12,3,7,2,4,3,1},{3,0,0,10,3,10,3,2,2,0},{0,3,0,16,4,16,4,4,4,0},{3,0,0,6,2,6,2,2,2,0},{6,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{6,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,12,3,7,2,4,3,1},{3,3,0,11,3,11,3,3,3,0},{3,0,0,16,4,16,4,4,4,0},{3,0,0,6,2,6,2,2,2,0},{7,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{7,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{6,0,0,10,3,10,3,2,2,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,6,2,6,2,2,2,0},{3,0,0,11,3,11,3,3,3,0},{3,0,0,11,3,11,3,3,3,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{3,6,0,11,3,11,3,3,3,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,6,2,6,2,2,2,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,2,0,4,1,4,1,4,4,0},{2,3,0,4,1,4,1,4,4,0},{2,4,0,4,1,4,1,4,4,0},{2,5,0,4,1,4,1,4,4,0},{2,6,0,4,1,4,1,4,4,0},{2,7,0,4,1,4,1,4,4,0},{2,3,0,7,2,7,2,3,3,0},{2,0,0,4,1,4,1,4,4,0},
-		{3,2,0,4,1,4,1,4,4,0},{3,3,0,4,1,4,1,4,4,0},{3,4,0,4,1,4,1,4,4,0},{3,5,0,4,1,4,1,4,4,0},{3,6,0,4,1,4,1,4,4,0},{3,7,0,4,1,4,1,4,4,0},{3,3,0,7,2,7,2,3,3,0},{3,0,0,4,1,4,1,4,4,0},
-		{4,2,0,4,1,4,1,4,4,0},{4,3,0,4,1,4,1,4,4,0},{4,4,0,4,1,4,1,4,4,0},{4,5,0,4,1,4,1,4,4,0},{4,6,0,4,1,4,1,4,4,0},{4,7,0,4,1,4,1,4,4,0},{4,3,0,7,2,7,2,3,3,0},{4,0,0,4,1,4,1,4,4,0},
-		{5,2,0,4,1,4,1,4,4,0},{5,3,0,4,1,4,1,4,4,0},{5,4,0,4,1,4,1,4,4,0},{5,5,0,4,1,4,1,4,4,0},{5,6,0,4,1,4,1,4,4,0},{5,7,0,4,1,4,1,4,4,0},{5,3,0,7,2,7,2,3,3,0},{5,0,0,4,1,4,1,4,4,0},
-		{6,2,0,4,1,4,1,4,4,0},{6,3,0,4,1,4,1,4,4,0},{6,4,0,4,1,4,1,4,4,0},{6,5,0,4,1,4,1,4,4,0},{6,6,0,4,1,4,1,4,4,0},{6,7,0,4,1,4,1,4,4,0},{6,3,0,7,2,7,2,3,3,0},{6,0,0,4,1,4,1,4,4,0},
-		{7,2,0,4,1,4,1,4,4,0},{7,3,0,4,1,4,1,4,4,0},{7,4,0,4,1,4,1,4,4,0},{7,5,0,4,1,4,1,4,4,0},{7,6,0,4,1,4,1,4,4,0},{7,7,0,4,1,4,1,4,4,0},{7,3,0,7,2,7,2,3,3,0},{7,0,0,4,1,4,1,4,4,0},
-		{3,2,0,7,2,7,2,3,3,0},{3,3,0,7,2,7,2,3,3,0},{3,4,0,7,2,7,2,3,3,0},{3,5,0,7,2,7,2,3,3,0},{3,6,0,7,2,7,2,3,3,0},{3,7,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},
-		{0,2,0,4,1,4,1,4,4,0},{0,3,0,4,1,4,1,4,4,0},{0,4,0,4,1,4,1,4,4,0},{0,5,0,4,1,4,1,4,4,0},{0,6,0,4,1,4,1,4,4,0},{0,7,0,4,1,4,1,4,4,0},{0,3,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,2,0,4,1,4,1,4,4,0},{0,3,0,4,1,4,1,4,4,0},{0,4,0,4,1,4,1,4,4,0},{0,5,0,4,1,4,1,4,4,0},{0,6,0,4,1,4,1,4,4,0},{0,7,0,4,1,4,1,4,4,0},{0,3,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,2,0,4,1,4,1,4,4,0},{0,3,0,4,1,4,1,4,4,0},{0,4,0,4,1,4,1,4,4,0},{0,5,0,4,1,4,1,4,4,0},{0,6,0,4,1,4,1,4,4,0},{0,7,0,4,1,4,1,4,4,0},{0,3,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,2,0,4,1,4,1,4,4,0},{0,3,0,4,1,4,1,4,4,0},{0,4,0,4,1,4,1,4,4,0},{0,5,0,4,1,4,1,4,4,0},{0,6,0,4,1,4,1,4,4,0},{0,7,0,4,1,4,1,4,4,0},{0,3,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,4,1,4,1,4,4,0},{3,0,0,4,1,4,1,4,4,0},{4,0,0,4,1,4,1,4,4,0},{5,0,0,4,1,4,1,4,4,0},{6,0,0,4,1,4,1,4,4,0},{7,0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
-		{1,0,0,11,3,5,1,3,5,1},{1,0,0,10,3,10,3,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
-		{0,0,0,11,3,5,1,3,5,1},{0,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{0,0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{2,0,0,10,3,10,3,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{0,0,0,4,1,4,1,4,4,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
-		{7,0,0,11,3,5,1,3,5,1},{3,0,0,10,3,10,3,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,3,0,19,5,19,5,3,3,0},{7,0,0,17,4,10,3,5,2,1},{3,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
-		{6,0,0,11,3,5,1,3,5,1},{3,0,0,4,1,4,1,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
-		{5,0,0,11,3,5,1,3,5,1},{0,0,0,10,3,10,3,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
-		{4,0,0,11,3,5,1,3,5,1},{6,3,0,6,2,6,2,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
-
-		{ {2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{6,0,0,8,2,8,2,4,4,0},{7,0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,6,0,8,2,8,2,4,4,0},{0,7,0,8,2,8,2,4,4,0},{0,3,0,12,3,12,3,4,4,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,2,0,8,2,8,2,4,4,0},{1,3,0,8,2,8,2,4,4,0},{1,4,0,8,2,8,2,4,4,0},{1,5,0,8,2,8,2,4,4,0},{1,6,0,8,2,8,2,4,4,0},{1,7,0,8,2,8,2,4,4,0},{1,3,0,12,3,12,3,4,4,0},{1,0,0,8,2,8,2,4,4,0},
-		{2,2,0,8,2,8,2,4,4,0},{2,3,0,8,2,8,2,4,4,0},{2,4,0,8,2,8,2,4,4,0},{2,5,0,8,2,8,2,4,4,0},{2,6,0,8,2,8,2,4,4,0},{2,7,0,8,2,8,2,4,4,0},{2,3,0,12,3,12,3,4,4,0},{2,0,0,8,2,8,2,4,4,0},
-		{3,2,0,8,2,8,2,4,4,0},{3,3,0,8,2,8,2,4,4,0},{3,4,0,8,2,8,2,4,4,0},{3,5,0,8,2,8,2,4,4,0},{3,6,0,8,2,8,2,4,4,0},{3,7,0,8,2,8,2,4,4,0},{3,3,0,12,3,12,3,4,4,0},{3,0,0,8,2,8,2,4,4,0},
-		{4,2,0,8,2,8,2,4,4,0},{4,3,0,8,2,8,2,4,4,0},{4,4,0,8,2,8,2,4,4,0},{4,5,0,8,2,8,2,4,4,0},{4,6,0,8,2,8,2,4,4,0},{4,7,0,8,2,8,2,4,4,0},{4,3,0,12,3,12,3,4,4,0},{4,0,0,8,2,8,2,4,4,0},
-		{5,2,0,8,2,8,2,4,4,0},{5,3,0,8,2,8,2,4,4,0},{5,4,0,8,2,8,2,4,4,0},{5,5,0,8,2,8,2,4,4,0},{5,6,0,8,2,8,2,4,4,0},{5,7,0,8,2,8,2,4,4,0},{5,3,0,12,3,12,3,4,4,0},{5,0,0,8,2,8,2,4,4,0},
-		{6,2,0,8,2,8,2,4,4,0},{6,3,0,8,2,8,2,4,4,0},{6,4,0,8,2,8,2,4,4,0},{6,5,0,8,2,8,2,4,4,0},{6,6,0,8,2,8,2,4,4,0},{6,7,0,8,2,8,2,4,4,0},{6,3,0,12,3,12,3,4,4,0},{6,0,0,8,2,8,2,4,4,0},
-		{7,2,0,8,2,8,2,4,4,0},{7,3,0,8,2,8,2,4,4,0},{7,4,0,8,2,8,2,4,4,0},{7,5,0,8,2,8,2,4,4,0},{7,6,0,8,2,8,2,4,4,0},{7,7,0,8,2,8,2,4,4,0},{7,3,0,12,3,12,3,4,4,0},{7,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,6,0,8,2,8,2,4,4,0},{0,7,0,8,2,8,2,4,4,0},{0,3,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,2,0,8,2,8,2,4,4,0},{1,3,0,8,2,8,2,4,4,0},{1,4,0,8,2,8,2,4,4,0},{1,5,0,8,2,8,2,4,4,0},{1,6,0,8,2,8,2,4,4,0},{1,7,0,8,2,8,2,4,4,0},{1,3,0,15,4,15,4,3,3,0},{1,0,0,8,2,8,2,4,4,0},
-		{2,2,0,8,2,8,2,4,4,0},{2,3,0,8,2,8,2,4,4,0},{2,4,0,8,2,8,2,4,4,0},{2,5,0,8,2,8,2,4,4,0},{2,6,0,8,2,8,2,4,4,0},{2,7,0,8,2,8,2,4,4,0},{2,3,0,15,4,15,4,3,3,0},{2,0,0,8,2,8,2,4,4,0},
-		{3,2,0,8,2,8,2,4,4,0},{3,3,0,8,2,8,2,4,4,0},{3,4,0,8,2,8,2,4,4,0},{3,5,0,8,2,8,2,4,4,0},{3,6,0,8,2,8,2,4,4,0},{3,7,0,8,2,8,2,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,0,0,8,2,8,2,4,4,0},
-		{4,2,0,8,2,8,2,4,4,0},{4,3,0,8,2,8,2,4,4,0},{4,4,0,8,2,8,2,4,4,0},{4,5,0,8,2,8,2,4,4,0},{4,6,0,8,2,8,2,4,4,0},{4,7,0,8,2,8,2,4,4,0},{4,3,0,15,4,15,4,3,3,0},{4,0,0,8,2,8,2,4,4,0},
-		{5,2,0,8,2,8,2,4,4,0},{5,3,0,8,2,8,2,4,4,0},{5,4,0,8,2,8,2,4,4,0},{5,5,0,8,2,8,2,4,4,0},{5,6,0,8,2,8,2,4,4,0},{5,7,0,8,2,8,2,4,4,0},{5,3,0,15,4,15,4,3,3,0},{5,0,0,8,2,8,2,4,4,0},
-		{6,2,0,8,2,8,2,4,4,0},{6,3,0,8,2,8,2,4,4,0},{6,4,0,8,2,8,2,4,4,0},{6,5,0,8,2,8,2,4,4,0},{6,6,0,8,2,8,2,4,4,0},{6,7,0,8,2,8,2,4,4,0},{6,3,0,15,4,15,4,3,3,0},{6,0,0,8,2,8,2,4,4,0},
-		{7,2,0,8,2,8,2,4,4,0},{7,3,0,8,2,8,2,4,4,0},{7,4,0,8,2,8,2,4,4,0},{7,5,0,8,2,8,2,4,4,0},{7,6,0,8,2,8,2,4,4,0},{7,7,0,8,2,8,2,4,4,0},{7,3,0,15,4,15,4,3,3,0},{7,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,6,0,8,2,8,2,4,4,0},{0,7,0,8,2,8,2,4,4,0},{0,3,0,15,4,15,4,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,2,0,8,2,8,2,4,4,0},{1,3,0,8,2,8,2,4,4,0},{1,4,0,8,2,8,2,4,4,0},{1,5,0,8,2,8,2,4,4,0},{1,6,0,8,2,8,2,4,4,0},{1,7,0,8,2,8,2,4,4,0},{1,3,0,15,4,15,4,3,3,0},{1,0,0,8,2,8,2,4,4,0},
-		{2,2,0,8,2,8,2,4,4,0},{2,3,0,8,2,8,2,4,4,0},{2,4,0,8,2,8,2,4,4,0},{2,5,0,8,2,8,2,4,4,0},{2,6,0,8,2,8,2,4,4,0},{2,7,0,8,2,8,2,4,4,0},{2,3,0,15,4,15,4,3,3,0},{2,0,0,8,2,8,2,4,4,0},
-		{3,2,0,8,2,8,2,4,4,0},{3,3,0,8,2,8,2,4,4,0},{3,4,0,8,2,8,2,4,4,0},{3,5,0,8,2,8,2,4,4,0},{3,6,0,8,2,8,2,4,4,0},{3,7,0,8,2,8,2,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,0,0,8,2,8,2,4,4,0},
-		{4,2,0,8,2,8,2,4,4,0},{4,3,0,8,2,8,2,4,4,0},{4,4,0,8,2,8,2,4,4,0},{4,5,0,8,2,8,2,4,4,0},{4,6,0,8,2,8,2,4,4,0},{4,7,0,8,2,8,2,4,4,0},{4,3,0,15,4,15,4,3,3,0},{4,0,0,8,2,8,2,4,4,0},
-		{5,2,0,8,2,8,2,4,4,0},{5,3,0,8,2,8,2,4,4,0},{5,4,0,8,2,8,2,4,4,0},{5,5,0,8,2,8,2,4,4,0},{5,6,0,8,2,8,2,4,4,0},{5,7,0,8,2,8,2,4,4,0},{5,3,0,15,4,15,4,3,3,0},{5,0,0,8,2,8,2,4,4,0},
-		{6,2,0,8,2,8,2,4,4,0},{6,3,0,8,2,8,2,4,4,0},{6,4,0,8,2,8,2,4,4,0},{6,5,0,8,2,8,2,4,4,0},{6,6,0,8,2,8,2,4,4,0},{6,7,0,8,2,8,2,4,4,0},{6,3,0,15,4,15,4,3,3,0},{6,0,0,8,2,8,2,4,4,0},
-		{7,2,0,8,2,8,2,4,4,0},{7,3,0,8,2,8,2,4,4,0},{7,4,0,8,2,8,2,4,4,0},{7,5,0,8,2,8,2,4,4,0},{7,6,0,8,2,8,2,4,4,0},{7,7,0,8,2,8,2,4,4,0},{7,3,0,15,4,15,4,3,3,0},{7,0,0,8,2,8,2,4,4,0} },
-
-		{ {0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{2,0,0,12,3,12,3,4,4,0},{0,2,0,12,3,12,3,4,4,0},{3,1,0,15,4,15,4,3,3,0},{0,1,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{14,0,0,9,2,9,2,5,5,0},
-		{3,0,0,12,3,12,3,4,4,0},{0,3,0,12,3,12,3,4,4,0},{3,1,0,15,4,15,4,3,3,0},{1,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{15,0,0,9,2,9,2,5,5,0},
-		{4,0,0,12,3,12,3,4,4,0},{0,4,0,12,3,12,3,4,4,0},{3,2,0,15,4,15,4,3,3,0},{0,2,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{1,0,0,8,2,8,2,4,4,0},{0,14,0,9,2,9,2,5,5,0},
-		{5,0,0,12,3,12,3,4,4,0},{0,5,0,12,3,12,3,4,4,0},{3,2,0,15,4,15,4,3,3,0},{2,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{2,0,0,8,2,8,2,4,4,0},{0,15,0,9,2,9,2,5,5,0},
-		{6,0,0,12,3,12,3,4,4,0},{0,6,0,12,3,12,3,4,4,0},{3,3,0,15,4,15,4,3,3,0},{0,3,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,18,5,18,5,2,2,0},
-		{7,0,0,12,3,12,3,4,4,0},{0,7,0,12,3,12,3,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,18,5,18,5,2,2,0},
-		{1,0,0,12,3,12,3,4,4,0},{0,0,0,12,3,12,3,4,4,0},{3,6,0,15,4,15,4,3,3,0},{0,6,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{1,0,0,8,2,8,2,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,12,3,12,3,4,4,0},{0,0,0,12,3,12,3,4,4,0},{3,6,0,15,4,15,4,3,3,0},{6,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{2,0,0,8,2,8,2,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,21,5,16,4,5,4,3},{0,0,0,21,5,16,4,5,4,4},{0,0,0,21,5,16,4,5,4,5},{0,0,0,21,5,16,4,5,4,6},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,21,5,16,4,5,4,3},{0,0,0,21,5,16,4,5,4,4},{0,0,0,21,5,16,4,5,4,5},{0,0,0,21,5,16,4,5,4,6},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0} },
-
-		{ {0,0,0,8,2,8,2,4,4,0},{1,0,0,14,4,14,4,2,2,0},{1,0,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{2,0,0,8,2,8,2,4,4,0},{2,0,0,8,2,8,2,4,4,0},{2,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{4,1,0,15,4,15,4,3,3,0},{0,1,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{3,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{3,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,13,3,8,2,5,4,2},{2,0,0,14,4,14,4,2,2,0},{2,0,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{4,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{4,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,12,3,12,3,4,4,0},{4,2,0,15,4,15,4,3,3,0},{0,2,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{5,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{5,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,0,0,12,3,7,2,4,3,1},{4,0,0,14,4,14,4,2,2,0},{0,4,0,20,5,20,5,4,4,0},{4,0,0,10,3,10,3,2,2,0},{8,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{8,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,12,3,7,2,4,3,1},{4,4,0,15,4,15,4,3,3,0},{4,0,0,20,5,20,5,4,4,0},{4,0,0,10,3,10,3,2,2,0},{9,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{9,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{6,0,0,14,4,14,4,2,2,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{4,6,0,15,4,15,4,3,3,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,2,0,8,2,8,2,4,4,0},{2,3,0,8,2,8,2,4,4,0},{2,4,0,8,2,8,2,4,4,0},{2,5,0,8,2,8,2,4,4,0},{2,8,0,8,2,8,2,4,4,0},{2,9,0,8,2,8,2,4,4,0},{2,4,0,19,5,19,5,3,3,0},{2,0,0,8,2,8,2,4,4,0},
-		{3,2,0,8,2,8,2,4,4,0},{3,3,0,8,2,8,2,4,4,0},{3,4,0,8,2,8,2,4,4,0},{3,5,0,8,2,8,2,4,4,0},{3,8,0,8,2,8,2,4,4,0},{3,9,0,8,2,8,2,4,4,0},{3,4,0,19,5,19,5,3,3,0},{3,0,0,8,2,8,2,4,4,0},
-		{4,2,0,8,2,8,2,4,4,0},{4,3,0,8,2,8,2,4,4,0},{4,4,0,8,2,8,2,4,4,0},{4,5,0,8,2,8,2,4,4,0},{4,8,0,8,2,8,2,4,4,0},{4,9,0,8,2,8,2,4,4,0},{4,4,0,19,5,19,5,3,3,0},{4,0,0,8,2,8,2,4,4,0},
-		{5,2,0,8,2,8,2,4,4,0},{5,3,0,8,2,8,2,4,4,0},{5,4,0,8,2,8,2,4,4,0},{5,5,0,8,2,8,2,4,4,0},{5,8,0,8,2,8,2,4,4,0},{5,9,0,8,2,8,2,4,4,0},{5,4,0,19,5,19,5,3,3,0},{5,0,0,8,2,8,2,4,4,0},
-		{8,2,0,8,2,8,2,4,4,0},{8,3,0,8,2,8,2,4,4,0},{8,4,0,8,2,8,2,4,4,0},{8,5,0,8,2,8,2,4,4,0},{8,8,0,8,2,8,2,4,4,0},{8,9,0,8,2,8,2,4,4,0},{6,4,0,19,5,19,5,3,3,0},{8,0,0,8,2,8,2,4,4,0},
-		{9,2,0,8,2,8,2,4,4,0},{9,3,0,8,2,8,2,4,4,0},{9,4,0,8,2,8,2,4,4,0},{9,5,0,8,2,8,2,4,4,0},{9,8,0,8,2,8,2,4,4,0},{9,9,0,8,2,8,2,4,4,0},{7,4,0,19,5,19,5,3,3,0},{9,0,0,8,2,8,2,4,4,0},
-		{4,2,0,19,5,19,5,3,3,0},{4,3,0,19,5,19,5,3,3,0},{4,4,0,19,5,19,5,3,3,0},{4,5,0,19,5,19,5,3,3,0},{4,6,0,19,5,19,5,3,3,0},{4,7,0,19,5,19,5,3,3,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,19,5,19,5,3,3,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,8,0,8,2,8,2,4,4,0},{0,9,0,8,2,8,2,4,4,0},{0,4,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,8,0,8,2,8,2,4,4,0},{0,9,0,8,2,8,2,4,4,0},{0,4,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,8,0,8,2,8,2,4,4,0},{0,9,0,8,2,8,2,4,4,0},{0,4,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,8,0,8,2,8,2,4,4,0},{0,9,0,8,2,8,2,4,4,0},{0,4,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{8,0,0,8,2,8,2,4,4,0},{9,0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,0,0,11,3,5,1,3,5,1},{1,0,0,14,4,14,4,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
-		{0,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,8,5,8,5,1,1,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{0,0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{2,0,0,14,4,14,4,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{0,0,0,8,2,8,2,4,4,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
-		{7,0,0,11,3,5,1,3,5,1},{4,0,0,14,4,14,4,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,4,0,23,6,23,6,3,3,0},{7,0,0,17,4,10,3,5,2,1},{4,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
-		{6,0,0,11,3,5,1,3,5,1},{4,0,0,8,2,8,2,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
-		{5,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
-		{4,0,0,11,3,5,1,3,5,1},{6,4,0,10,3,10,3,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
-
-		{ {0,0,0,8,2,8,2,4,4,0},{1,0,0,14,4,14,4,2,2,0},{1,0,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{2,0,0,8,2,8,2,4,4,0},{2,0,0,8,2,8,2,4,4,0},{2,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,4,1,4,1,4,4,0},{5,1,0,15,4,15,4,3,3,0},{0,1,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{3,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{3,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,13,3,8,2,5,4,2},{2,0,0,14,4,14,4,2,2,0},{2,0,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{4,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{4,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,12,3,12,3,4,4,0},{5,2,0,15,4,15,4,3,3,0},{0,2,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{5,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{5,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,0,0,12,3,7,2,4,3,1},{5,0,0,14,4,14,4,2,2,0},{0,5,0,20,5,20,5,4,4,0},{5,0,0,10,3,10,3,2,2,0},{10,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{10,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,0,0,12,3,7,2,4,3,1},{5,5,0,15,4,15,4,3,3,0},{5,0,0,20,5,20,5,4,4,0},{5,0,0,10,3,10,3,2,2,0},{11,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{11,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{6,0,0,14,4,14,4,2,2,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{3,0,0,12,3,7,2,4,3,1},{5,6,0,15,4,15,4,3,3,0},{0,0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,2,0,8,2,8,2,4,4,0},{2,3,0,8,2,8,2,4,4,0},{2,4,0,8,2,8,2,4,4,0},{2,5,0,8,2,8,2,4,4,0},{2,10,0,8,2,8,2,4,4,0},{2,11,0,8,2,8,2,4,4,0},{2,5,0,19,5,19,5,3,3,0},{2,0,0,8,2,8,2,4,4,0},
-		{3,2,0,8,2,8,2,4,4,0},{3,3,0,8,2,8,2,4,4,0},{3,4,0,8,2,8,2,4,4,0},{3,5,0,8,2,8,2,4,4,0},{3,10,0,8,2,8,2,4,4,0},{3,11,0,8,2,8,2,4,4,0},{3,5,0,19,5,19,5,3,3,0},{3,0,0,8,2,8,2,4,4,0},
-		{4,2,0,8,2,8,2,4,4,0},{4,3,0,8,2,8,2,4,4,0},{4,4,0,8,2,8,2,4,4,0},{4,5,0,8,2,8,2,4,4,0},{4,10,0,8,2,8,2,4,4,0},{4,11,0,8,2,8,2,4,4,0},{4,5,0,19,5,19,5,3,3,0},{4,0,0,8,2,8,2,4,4,0},
-		{5,2,0,8,2,8,2,4,4,0},{5,3,0,8,2,8,2,4,4,0},{5,4,0,8,2,8,2,4,4,0},{5,5,0,8,2,8,2,4,4,0},{5,10,0,8,2,8,2,4,4,0},{5,11,0,8,2,8,2,4,4,0},{5,5,0,19,5,19,5,3,3,0},{5,0,0,8,2,8,2,4,4,0},
-		{10,2,0,8,2,8,2,4,4,0},{10,3,0,8,2,8,2,4,4,0},{10,4,0,8,2,8,2,4,4,0},{10,5,0,8,2,8,2,4,4,0},{10,10,0,8,2,8,2,4,4,0},{10,11,0,8,2,8,2,4,4,0},{6,5,0,19,5,19,5,3,3,0},{10,0,0,8,2,8,2,4,4,0},
-		{11,2,0,8,2,8,2,4,4,0},{11,3,0,8,2,8,2,4,4,0},{11,4,0,8,2,8,2,4,4,0},{11,5,0,8,2,8,2,4,4,0},{11,10,0,8,2,8,2,4,4,0},{11,11,0,8,2,8,2,4,4,0},{7,5,0,19,5,19,5,3,3,0},{11,0,0,8,2,8,2,4,4,0},
-		{5,2,0,19,5,19,5,3,3,0},{5,3,0,19,5,19,5,3,3,0},{5,4,0,19,5,19,5,3,3,0},{5,5,0,19,5,19,5,3,3,0},{5,6,0,19,5,19,5,3,3,0},{5,7,0,19,5,19,5,3,3,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,19,5,19,5,3,3,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,10,0,8,2,8,2,4,4,0},{0,11,0,8,2,8,2,4,4,0},{0,5,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,10,0,8,2,8,2,4,4,0},{0,11,0,8,2,8,2,4,4,0},{0,5,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,10,0,8,2,8,2,4,4,0},{0,11,0,8,2,8,2,4,4,0},{0,5,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{0,2,0,8,2,8,2,4,4,0},{0,3,0,8,2,8,2,4,4,0},{0,4,0,8,2,8,2,4,4,0},{0,5,0,8,2,8,2,4,4,0},{0,10,0,8,2,8,2,4,4,0},{0,11,0,8,2,8,2,4,4,0},{0,5,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{2,0,0,8,2,8,2,4,4,0},{3,0,0,8,2,8,2,4,4,0},{4,0,0,8,2,8,2,4,4,0},{5,0,0,8,2,8,2,4,4,0},{10,0,0,8,2,8,2,4,4,0},{11,0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
-		{1,0,0,11,3,5,1,3,5,1},{1,0,0,14,4,14,4,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
-		{0,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,8,5,8,5,1,1,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{0,0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{2,0,0,14,4,14,4,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
-		{3,0,0,11,3,5,1,3,5,1},{0,0,0,8,2,8,2,4,4,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
-		{7,0,0,11,3,5,1,3,5,1},{5,0,0,14,4,14,4,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,5,0,23,6,23,6,3,3,0},{7,0,0,17,4,10,3,5,2,1},{5,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
-		{6,0,0,11,3,5,1,3,5,1},{5,0,0,8,2,8,2,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
-		{5,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
-		{4,0,0,11,3,5,1,3,5,1},{6,5,0,10,3,10,3,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
-
-		{ {4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{4,2,0,23,6,23,6,3,3,0},{4,3,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,6,0,23,6,23,6,3,3,0},{4,7,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},
-		{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},
-		{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},
-		{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},
-		{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},
-		{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},
-		{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},
-		{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},
-		{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},
-		{0,4,2,23,6,23,6,3,3,0},{0,4,3,23,6,23,6,3,3,0},{0,4,4,23,6,23,6,3,3,0},{0,4,5,23,6,23,6,3,3,0},{0,4,6,23,6,23,6,3,3,0},{0,4,7,23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},
-		{1,4,2,23,6,23,6,3,3,0},{1,4,3,23,6,23,6,3,3,0},{1,4,4,23,6,23,6,3,3,0},{1,4,5,23,6,23,6,3,3,0},{1,4,6,23,6,23,6,3,3,0},{1,4,7,23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},
-		{2,4,2,23,6,23,6,3,3,0},{2,4,3,23,6,23,6,3,3,0},{2,4,4,23,6,23,6,3,3,0},{2,4,5,23,6,23,6,3,3,0},{2,4,6,23,6,23,6,3,3,0},{2,4,7,23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},
-		{3,4,2,23,6,23,6,3,3,0},{3,4,3,23,6,23,6,3,3,0},{3,4,4,23,6,23,6,3,3,0},{3,4,5,23,6,23,6,3,3,0},{3,4,6,23,6,23,6,3,3,0},{3,4,7,23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},
-		{4,4,2,23,6,23,6,3,3,0},{4,4,3,23,6,23,6,3,3,0},{4,4,4,23,6,23,6,3,3,0},{4,4,5,23,6,23,6,3,3,0},{4,4,6,23,6,23,6,3,3,0},{4,4,7,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},
-		{5,4,2,23,6,23,6,3,3,0},{5,4,3,23,6,23,6,3,3,0},{5,4,4,23,6,23,6,3,3,0},{5,4,5,23,6,23,6,3,3,0},{5,4,6,23,6,23,6,3,3,0},{5,4,7,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},
-		{6,4,2,23,6,23,6,3,3,0},{6,4,3,23,6,23,6,3,3,0},{6,4,4,23,6,23,6,3,3,0},{6,4,5,23,6,23,6,3,3,0},{6,4,6,23,6,23,6,3,3,0},{6,4,7,23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},
-		{7,4,2,23,6,23,6,3,3,0},{7,4,3,23,6,23,6,3,3,0},{7,4,4,23,6,23,6,3,3,0},{7,4,5,23,6,23,6,3,3,0},{7,4,6,23,6,23,6,3,3,0},{7,4,7,23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0},
-		{0,4,2,23,6,23,6,3,3,0},{0,4,3,23,6,23,6,3,3,0},{0,4,4,23,6,23,6,3,3,0},{0,4,5,23,6,23,6,3,3,0},{0,4,6,23,6,23,6,3,3,0},{0,4,7,23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},
-		{1,4,2,23,6,23,6,3,3,0},{1,4,3,23,6,23,6,3,3,0},{1,4,4,23,6,23,6,3,3,0},{1,4,5,23,6,23,6,3,3,0},{1,4,6,23,6,23,6,3,3,0},{1,4,7,23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},
-		{2,4,2,23,6,23,6,3,3,0},{2,4,3,23,6,23,6,3,3,0},{2,4,4,23,6,23,6,3,3,0},{2,4,5,23,6,23,6,3,3,0},{2,4,6,23,6,23,6,3,3,0},{2,4,7,23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},
-		{3,4,2,23,6,23,6,3,3,0},{3,4,3,23,6,23,6,3,3,0},{3,4,4,23,6,23,6,3,3,0},{3,4,5,23,6,23,6,3,3,0},{3,4,6,23,6,23,6,3,3,0},{3,4,7,23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},
-		{4,4,2,23,6,23,6,3,3,0},{4,4,3,23,6,23,6,3,3,0},{4,4,4,23,6,23,6,3,3,0},{4,4,5,23,6,23,6,3,3,0},{4,4,6,23,6,23,6,3,3,0},{4,4,7,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},
-		{5,4,2,23,6,23,6,3,3,0},{5,4,3,23,6,23,6,3,3,0},{5,4,4,23,6,23,6,3,3,0},{5,4,5,23,6,23,6,3,3,0},{5,4,6,23,6,23,6,3,3,0},{5,4,7,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},
-		{6,4,2,23,6,23,6,3,3,0},{6,4,3,23,6,23,6,3,3,0},{6,4,4,23,6,23,6,3,3,0},{6,4,5,23,6,23,6,3,3,0},{6,4,6,23,6,23,6,3,3,0},{6,4,7,23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},
-		{7,4,2,23,6,23,6,3,3,0},{7,4,3,23,6,23,6,3,3,0},{7,4,4,23,6,23,6,3,3,0},{7,4,5,23,6,23,6,3,3,0},{7,4,6,23,6,23,6,3,3,0},{7,4,7,23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0} },
-
-		{ {5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{5,2,0,23,6,23,6,3,3,0},{5,3,0,23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,6,0,23,6,23,6,3,3,0},{5,7,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},
-		{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},
-		{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},
-		{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},
-		{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},
-		{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},
-		{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},
-		{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},
-		{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},
-		{0,5,2,23,6,23,6,3,3,0},{0,5,3,23,6,23,6,3,3,0},{0,5,4,23,6,23,6,3,3,0},{0,5,5,23,6,23,6,3,3,0},{0,5,6,23,6,23,6,3,3,0},{0,5,7,23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},
-		{1,5,2,23,6,23,6,3,3,0},{1,5,3,23,6,23,6,3,3,0},{1,5,4,23,6,23,6,3,3,0},{1,5,5,23,6,23,6,3,3,0},{1,5,6,23,6,23,6,3,3,0},{1,5,7,23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},
-		{2,5,2,23,6,23,6,3,3,0},{2,5,3,23,6,23,6,3,3,0},{2,5,4,23,6,23,6,3,3,0},{2,5,5,23,6,23,6,3,3,0},{2,5,6,23,6,23,6,3,3,0},{2,5,7,23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},
-		{3,5,2,23,6,23,6,3,3,0},{3,5,3,23,6,23,6,3,3,0},{3,5,4,23,6,23,6,3,3,0},{3,5,5,23,6,23,6,3,3,0},{3,5,6,23,6,23,6,3,3,0},{3,5,7,23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},
-		{4,5,2,23,6,23,6,3,3,0},{4,5,3,23,6,23,6,3,3,0},{4,5,4,23,6,23,6,3,3,0},{4,5,5,23,6,23,6,3,3,0},{4,5,6,23,6,23,6,3,3,0},{4,5,7,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},
-		{5,5,2,23,6,23,6,3,3,0},{5,5,3,23,6,23,6,3,3,0},{5,5,4,23,6,23,6,3,3,0},{5,5,5,23,6,23,6,3,3,0},{5,5,6,23,6,23,6,3,3,0},{5,5,7,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},
-		{6,5,2,23,6,23,6,3,3,0},{6,5,3,23,6,23,6,3,3,0},{6,5,4,23,6,23,6,3,3,0},{6,5,5,23,6,23,6,3,3,0},{6,5,6,23,6,23,6,3,3,0},{6,5,7,23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},
-		{7,5,2,23,6,23,6,3,3,0},{7,5,3,23,6,23,6,3,3,0},{7,5,4,23,6,23,6,3,3,0},{7,5,5,23,6,23,6,3,3,0},{7,5,6,23,6,23,6,3,3,0},{7,5,7,23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0},
-		{0,5,2,23,6,23,6,3,3,0},{0,5,3,23,6,23,6,3,3,0},{0,5,4,23,6,23,6,3,3,0},{0,5,5,23,6,23,6,3,3,0},{0,5,6,23,6,23,6,3,3,0},{0,5,7,23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},
-		{1,5,2,23,6,23,6,3,3,0},{1,5,3,23,6,23,6,3,3,0},{1,5,4,23,6,23,6,3,3,0},{1,5,5,23,6,23,6,3,3,0},{1,5,6,23,6,23,6,3,3,0},{1,5,7,23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},
-		{2,5,2,23,6,23,6,3,3,0},{2,5,3,23,6,23,6,3,3,0},{2,5,4,23,6,23,6,3,3,0},{2,5,5,23,6,23,6,3,3,0},{2,5,6,23,6,23,6,3,3,0},{2,5,7,23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},
-		{3,5,2,23,6,23,6,3,3,0},{3,5,3,23,6,23,6,3,3,0},{3,5,4,23,6,23,6,3,3,0},{3,5,5,23,6,23,6,3,3,0},{3,5,6,23,6,23,6,3,3,0},{3,5,7,23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},
-		{4,5,2,23,6,23,6,3,3,0},{4,5,3,23,6,23,6,3,3,0},{4,5,4,23,6,23,6,3,3,0},{4,5,5,23,6,23,6,3,3,0},{4,5,6,23,6,23,6,3,3,0},{4,5,7,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},
-		{5,5,2,23,6,23,6,3,3,0},{5,5,3,23,6,23,6,3,3,0},{5,5,4,23,6,23,6,3,3,0},{5,5,5,23,6,23,6,3,3,0},{5,5,6,23,6,23,6,3,3,0},{5,5,7,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},
-		{6,5,2,23,6,23,6,3,3,0},{6,5,3,23,6,23,6,3,3,0},{6,5,4,23,6,23,6,3,3,0},{6,5,5,23,6,23,6,3,3,0},{6,5,6,23,6,23,6,3,3,0},{6,5,7,23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},
-		{7,5,2,23,6,23,6,3,3,0},{7,5,3,23,6,23,6,3,3,0},{7,5,4,23,6,23,6,3,3,0},{7,5,5,23,6,23,6,3,3,0},{7,5,6,23,6,23,6,3,3,0},{7,5,7,23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0} } };
-
-
-ZBYTE endianess_fix[256 * 7] = {
-		0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,
-		0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,2,0,0,0,0,0,1,0,1,0,1,1,1,0,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,2,2,2,2,2,2,0,2,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,1,1,1,1,1,1,0,1,3,3,3,3,3,3,1,3,
-		1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
-		0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,1,0,1,1,1,0,1,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-		1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
-		1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		1,2,0,0,0,0,0,3,1,2,0,0,0,0,0,3,1,2,0,0,0,0,0,3,1,2,0,0,0,0,0,3,
-		1,2,0,0,0,0,0,0,1,2,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,2,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-		0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,
-		0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,2,0,0,0,0,0,1,0,1,0,1,1,1,0,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,2,2,2,2,2,2,0,2,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,1,1,1,1,1,1,0,1,3,3,3,3,3,3,1,3,
-		1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
-		0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,1,0,1,1,1,0,1,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-		0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,0,0,2,0,1,1,1,0,0,0,1,0,1,1,1,0,
-		0,0,0,0,1,1,1,0,0,0,0,0,1,1,1,0,0,0,2,0,0,0,0,0,1,0,1,0,1,1,1,0,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,2,2,2,2,2,2,0,2,3,3,3,3,3,3,1,3,
-		3,3,3,3,3,3,1,3,3,3,3,3,3,3,1,3,1,1,1,1,1,1,0,1,3,3,3,3,3,3,1,3,
-		1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,
-		0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,1,0,1,1,1,0,1,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,
-		4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,0,4 };
+
+	// Flag and dispatch tables, read only and shared by all instances
+	static const ZBYTE parity[256];
+	static const ZBYTE SZ_table[256];
+	static const ZBYTE SZP_table[256];
+	static const int V_table[4];
+
+	static const OPCODES main_instructions[256];
+	static const OPCODES cb_instructions[256];
+	static const OPCODES ed_instructions[256];
+	static const OPCODES dd_instructions[256];
+	static const OPCODES fd_instructions[256];
+	static const OPCODES ddcb_instructions[256];
+	static const OPCODES fdcb_instructions[256];
+	static const OPCODES *const instruction_tables[7];		// By i_set
+
+	// Decode metadata for every prefix, read only and shared by all instances
+	static const ARGUMENT_SETS a_set[7];
+
+#ifdef __Z80BUSTIMING__
+	static const ZWORD bus_gap_table[7][256];
+#endif
 
 
 	void ADC_RR_RR();
@@ -0,0 +1,99 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_BATCH_H_
+#define Z80_BATCH_H_
+
+#include <functional>
+#include <vector>
+
+#include "z80.h"
+
+
+/*
+ * Many instances of one program, registers kept as one array per register.
+ *
+ * Every Step() runs one instruction on every lane. Lanes are regrouped by
+ * the opcode they are about to execute, so lanes whose PC went elsewhere
+ * just land in another group. Groups of common unprefixed instructions run
+ * as straight loops over the lanes (contiguous when all lanes agree, index
+ * gathers otherwise); anything else, and lanes that are halted or just did
+ * EI, go through a scalar Z80, which stays the reference. Every lane has its
+ * own 64 KB at GetMemory(lane). SelfTest() checks lane by lane against the
+ * scalar core.
+ */
+class Z80Batch {
+
+public:
+
+	Z80Batch(unsigned int lanes);
+
+	unsigned int GetLanes();
+	ZBYTE *GetMemory(unsigned int lane);
+
+	void Load(unsigned int lane, Z80 *cpu);
+	void Store(unsigned int lane, Z80 *cpu);
+
+	void SetIOReadCallback(std::function<ZBYTE(unsigned int, ZWORD)> cb);
+	void SetIOWriteCallback(std::function<void(unsigned int, ZWORD, ZBYTE)> cb);
+
+	void Step();
+	void Run(unsigned int steps);
+
+	ZQWORD GetClock(unsigned int lane);
+	ZQWORD GetVectorized();
+	ZQWORD GetScalar();
+
+	int SelfTest(unsigned int steps);
+
+private:
+
+	unsigned int lanes;
+	std::vector<ZBYTE> memory;		// Lane n at n << 16
+
+	std::vector<ZBYTE> a, f, b, c, d, e, h, l, i, r;
+	std::vector<ZWORD> ix, iy, sp, wz, pc;
+	std::vector<ZWORD> af_, bc_, de_, hl_;
+	std::vector<ZBYTE> iff1, iff2, im;
+	std::vector<unsigned int> events;
+	std::vector<ZQWORD> clock;
+	std::vector<unsigned int> stall;		// Pending WAIT / BUSREQ T-states
+	std::vector<ZBYTE> irq_data;
+	std::vector<ZWORD> irq_vector;
+
+	std::vector<unsigned int> order;		// Lanes sorted by next opcode
+	std::vector<unsigned int> keys;
+
+	ZQWORD vectorized = 0;
+	ZQWORD scalar = 0;
+
+	Z80 ref;
+	unsigned int ref_lane = 0;
+	std::function<ZBYTE(unsigned int, ZWORD)> IOReadCallback;
+	std::function<void(unsigned int, ZWORD, ZBYTE)> IOWriteCallback;
+
+	ZBYTE SZ[256];
+	ZBYTE SZP[256];
+
+	template <bool DENSE> bool Execute(ZBYTE op, const unsigned int *idx, unsigned int n);
+	template <bool DENSE> void Alu(unsigned int kind, const ZBYTE *src, bool immediate, const unsigned int *idx, unsigned int n);
+	void Scalar(unsigned int lane);
+	bool Same(unsigned int lane, Z80 *cpu);
+};
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_BISECT_H_
+#define Z80_BISECT_H_
+
+#include <functional>
+
+#include "z80.h"
+
+
+// One way of running the emulator: a core, a build, a memory mode. Must be
+// deterministic, feed I/O from a Z80Replayer or pure callbacks.
+typedef struct {
+	const char *name;
+	std::function<void(const Z80STATE *)> load;
+	std::function<void(Z80STATE *)> save;
+	std::function<void(unsigned int)> step;		// Instructions
+} Z80ENGINE;
+
+
+/*
+ * Finds the first instruction where two engines stop agreeing.
+ *
+ * Both start from the same state and run checkpoint instructions at a time,
+ * comparing hashes of their states. At the first checkpoint that differs
+ * both go back to the last one that matched and binary search the
+ * instructions in between. Decode progress, I/O counters and bus timing
+ * bookkeeping aren't compared; registers, flip-flops, events, clock and
+ * memory are. A difference that heals before the next checkpoint (a flag
+ * recomputed right away) goes unnoticed, use shorter checkpoints to catch
+ * those.
+ */
+class Z80Bisect {
+
+public:
+
+	Z80Bisect(const Z80ENGINE *a, const Z80ENGINE *b);
+	~Z80Bisect();
+
+	Z80Bisect(const Z80Bisect &) = delete;
+	Z80Bisect &operator=(const Z80Bisect &) = delete;
+
+	long long Find(const Z80STATE *initial, ZQWORD steps, unsigned int checkpoint = 10000);
+	void Show();
+
+	static ZQWORD Hash(const Z80STATE *state);
+
+private:
+
+	const Z80ENGINE *a;
+	const Z80ENGINE *b;
+
+	Z80STATE *good;			// Last state both agreed on
+	Z80STATE *state_a;
+	Z80STATE *state_b;
+	long long found = -1;
+
+	bool Same(unsigned int steps);
+	static void Normalize(Z80STATE *state);
+};
+
+#endif
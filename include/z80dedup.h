@@ -0,0 +1,91 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_DEDUP_H_
+#define Z80_DEDUP_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "z80memory.h"
+
+
+/*
+ * Merges identical pages across parked Z80Memory instances into shared
+ * copy-on-write pages, in the spirit of KSM.
+ *
+ * Only parked instances are touched, one page at a time, so a running
+ * emulation thread is never stopped. Pages are content-hashed; a page is
+ * made canonical the first time a second copy of it shows up.
+ */
+class Z80PageDedup {
+
+public:
+
+	Z80PageDedup();
+	~Z80PageDedup();
+
+	void Register(Z80Memory *mem);
+	void Unregister(Z80Memory *mem);
+
+	void Pass();
+
+	void Start(unsigned int interval_ms);
+	void Stop();
+
+	ZQWORD GetBytesSaved();
+	ZQWORD GetPasses();
+
+private:
+
+	typedef struct {
+		Z80Memory *mem;
+		int index;
+		Z80PAGE *page;
+	} CANDIDATE;
+
+	std::mutex lock;
+	std::vector<Z80Memory *> memories;
+	std::unordered_multimap<ZQWORD, Z80PAGE *> canonical;
+	std::unordered_set<Z80PAGE *> canonical_pages;
+	std::unordered_map<ZQWORD, CANDIDATE> candidates;
+
+	std::thread worker;
+	std::mutex worker_lock;
+	std::condition_variable wakeup;
+	bool running = false;
+
+	std::atomic<ZQWORD> bytes_saved;
+	std::atomic<ZQWORD> passes;
+
+	void ScanPage(Z80Memory *mem, int index);
+	Z80PAGE *FindCanonical(ZQWORD hash, Z80PAGE *page);
+	void Merge(Z80Memory *mem, int index, Z80PAGE *target);
+	void Purge();
+
+	static bool Hold(Z80Memory *mem);
+	static void Release(Z80Memory *mem);
+	static ZQWORD Hash(const ZBYTE *data);
+};
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_DMA_H_
+#define Z80_DMA_H_
+
+#include "z80.h"
+#include "z80memory.h"
+
+
+/*
+ * Block transfers that steal the bus from a CPU.
+ *
+ * The whole block is moved at once on the memory layer (the CPU's flat
+ * memory, or a Z80Memory) and the CPU is charged the T-states the DMA would
+ * have held the bus for through BusRequest(). Copies behave like a byte by
+ * byte upward transfer, overlapping blocks included. Writes to flat memory
+ * are marked dirty, so TakeDirtyPages() and the users of it see them.
+ */
+class Z80DMA {
+
+public:
+
+	Z80DMA(Z80 *cpu);
+	Z80DMA(Z80 *cpu, Z80Memory *mem);
+
+	void SetByteTStates(unsigned int ts);
+
+	unsigned int Copy(ZWORD dst, ZWORD src, unsigned int len);
+	unsigned int Fill(ZWORD dst, ZBYTE val, unsigned int len);
+
+private:
+
+	Z80 *cpu;
+	Z80Memory *mem;
+
+	unsigned int byte_tstates = 6;		// One 3 T-state read plus one 3 T-state write
+
+	unsigned int Charge(unsigned int len);
+};
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_EXPLORE_H_
+#define Z80_EXPLORE_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "z80.h"
+#include "z80hash.h"
+
+
+// Z80STATE up to the address space
+#define Z80EXPLORE_HEADER	offsetof(Z80STATE, memory)
+
+
+typedef struct {
+	ZQWORD states;				// Distinct states found, the initial one included
+	ZQWORD duplicates;			// Steps that led to a state already found
+	ZQWORD expanded;			// States whose every input was tried
+	ZQWORD steps;				// Input steps run
+	unsigned int depth;			// Deepest state found
+	ZQWORD pages;				// Memory pages alive now
+	ZQWORD peak_pages;
+	double seconds;
+} Z80EXPLORESTATS;
+
+
+/*
+ * Searches the states a program reaches for every sequence of inputs.
+ *
+ * A step loads a state, calls the step callback (to raise the frame
+ * interrupt, say), runs a fixed number of T-states with every IN returning
+ * what the input callback says for the input being tried, and fingerprints
+ * the result. States are kept as registers plus a table of 256 byte pages
+ * shared copy-on-write with the state they came from: a step only copies
+ * the pages the CPU wrote. States already found, by Z80StateHash
+ * fingerprint with the counters left out, are dropped.
+ *
+ * Without a score callback the search is breadth first, so the first goal
+ * found is one of the fewest steps. With one, the best scored states go
+ * first (best-first). States are expanded batch by batch, the batch spread
+ * over the worker threads; results are merged in a fixed order, so the
+ * outcome doesn't depend on the number of threads. The caller's thread is
+ * the first worker, the others live as long as the explorer and sleep
+ * between batches. Callbacks run on the workers, each with its own CPU;
+ * they must not write memory.
+ *
+ * Pages are the 256 bytes Z80::TakeDirtyPages() tracks, not Z80Memory's
+ * 1 KB ones, and the workers' CPUs run on plain flat memory.
+ */
+class Z80Explorer {
+
+public:
+
+	typedef std::function<ZBYTE(ZWORD port, unsigned int input)> INPUTFUNCTION;
+	typedef std::function<void(Z80 *)> STEPFUNCTION;
+	typedef std::function<double(Z80 *)> SCOREFUNCTION;
+	typedef std::function<bool(Z80 *)> GOALFUNCTION;
+
+	Z80Explorer(unsigned int inputs, unsigned int tstates, unsigned int threads = 0);
+	~Z80Explorer();
+
+	Z80Explorer(const Z80Explorer &) = delete;
+	Z80Explorer &operator=(const Z80Explorer &) = delete;
+
+	void SetInputCallback(INPUTFUNCTION cb);
+	void SetStepCallback(STEPFUNCTION cb);
+	void SetScoreCallback(SCOREFUNCTION cb);
+	void SetGoalCallback(GOALFUNCTION cb);
+	void SetBatch(unsigned int states);
+
+	long long Explore(const Z80STATE *initial, ZQWORD max_states, unsigned int max_depth);
+	std::vector<unsigned int> GetPath(long long id);
+
+	Z80EXPLORESTATS GetStats();
+	unsigned int GetThreads();
+
+private:
+
+	typedef struct {
+		std::atomic<int> refs;
+		ZBYTE data[Z80HASH_PAGE_SIZE];
+	} PAGE;
+
+	typedef struct {
+		long long id;
+		double score;
+		ZBYTE state[Z80EXPLORE_HEADER];
+		PAGE *pages[Z80HASH_PAGES];
+	} NODE;
+
+	typedef struct {
+		long long parent;			// -1 for the initial state
+		unsigned int input;
+		unsigned int depth;
+	} RECORD;
+
+	typedef struct {
+		NODE *node;					// Null when the step led to a known state
+		Z80FINGERPRINT fingerprint;
+		bool goal;
+	} CHILD;
+
+	typedef struct {
+		Z80 cpu;
+		ZBYTE *memory;
+		PAGE *loaded[Z80HASH_PAGES];	// Pages memory holds (a reference each), null if written
+		Z80StateHash *hash;
+		Z80STATE *state;				// Registers only, scratch for Save/LoadState()
+		unsigned int input;
+		ZQWORD duplicates;
+		ZQWORD steps;
+	} WORKER;
+
+	struct FINGERPRINTHASH {
+		size_t operator()(const Z80FINGERPRINT &f) const { return f.lo; }
+	};
+	struct FINGERPRINTEQUAL {
+		bool operator()(const Z80FINGERPRINT &a, const Z80FINGERPRINT &b) const { return a.lo == b.lo && a.hi == b.hi; }
+	};
+	struct WORSE {
+		bool operator()(const NODE *a, const NODE *b) const {
+			return a->score < b->score || (a->score == b->score && a->id > b->id);
+		}
+	};
+
+	unsigned int inputs;
+	unsigned int tstates;
+	unsigned int threads;
+	unsigned int batch = 1024;
+
+	INPUTFUNCTION InputCallback;
+	STEPFUNCTION StepCallback;
+	SCOREFUNCTION ScoreCallback;
+	GOALFUNCTION GoalCallback;
+
+	std::vector<WORKER *> workers;
+	std::vector<std::thread> helpers;	// Run workers 1 and up
+
+	// Current batch, and the handshake starting it on the helpers
+	std::vector<NODE *> parents;
+	std::vector<CHILD> children;
+	std::atomic<unsigned int> next;
+	std::mutex round_lock;
+	std::condition_variable round_start;
+	std::condition_variable round_done;
+	unsigned int round = 0;
+	unsigned int busy = 0;				// Helpers still in the current round
+	bool stopping = false;
+	std::vector<RECORD> records;
+	std::unordered_set<Z80FINGERPRINT, FINGERPRINTHASH, FINGERPRINTEQUAL> seen;
+	std::deque<NODE *> fifo;		// Breadth first
+	std::priority_queue<NODE *, std::vector<NODE *>, WORSE> best;	// Best-first
+
+	std::atomic<long long> live_pages;
+	Z80EXPLORESTATS stats;
+
+	void Helper(WORKER *worker);
+	void Work(WORKER *worker);
+	void Load(WORKER *worker, const NODE *node);
+	void Expand(WORKER *worker, const NODE *node, CHILD *children);
+	NODE *Fork(WORKER *worker, const NODE *parent, const ZQWORD written[4]);
+	void Release(NODE *node);
+	void Drop(PAGE *page);
+	void Clear();
+};
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_HASH_H_
+#define Z80_HASH_H_
+
+#include <stddef.h>
+
+#include "z80.h"
+
+
+#define Z80HASH_PAGE_BITS	8		// Same pages as Z80::TakeDirtyPages()
+#define Z80HASH_PAGE_SIZE	(1 << Z80HASH_PAGE_BITS)
+#define Z80HASH_PAGES		((0xffff + 1) >> Z80HASH_PAGE_BITS)
+
+
+// 128 bit fingerprint, lo alone is a fine 64 bit hash
+typedef struct {
+	ZQWORD lo;
+	ZQWORD hi;
+} Z80FINGERPRINT;
+
+
+/*
+ * Fingerprint of a CPU's state and memory, kept up to date incrementally.
+ *
+ * Every 256 byte page has its hash cached; Update() rehashes the pages the
+ * CPU wrote since the last call and folds all of them, by position, into a
+ * running sum, then adds the registers. Touch() the pages the host writes
+ * to straight through the memory pointer. Registers include the decode
+ * progress of an instruction in flight. The page kernel keeps 8 lanes of
+ * 64 bit accumulators fed with 32 x 32 -> 64 bit multiplies, which the
+ * compiler turns into SIMD code with plain -O3.
+ */
+class Z80StateHash {
+
+public:
+
+	Z80StateHash(Z80 *cpu);
+	~Z80StateHash();
+
+	Z80StateHash(const Z80StateHash &) = delete;
+	Z80StateHash &operator=(const Z80StateHash &) = delete;
+
+	void SetCounters(bool on);
+	void Touch(ZWORD addr, unsigned int len);
+	void Invalidate();
+
+	Z80FINGERPRINT Update();
+
+	static Z80FINGERPRINT Hash(const ZBYTE *data, size_t len, ZQWORD seed);
+
+private:
+
+	Z80 *cpu;
+	bool counters = true;
+	Z80STATE *state;					// Registers only, scratch for SaveState()
+
+	ZQWORD pending[4];					// Pages to rehash
+	Z80FINGERPRINT pages[Z80HASH_PAGES];
+	Z80FINGERPRINT memory;				// Sum of the pages, mixed with their number
+
+	static Z80FINGERPRINT Position(Z80FINGERPRINT page, unsigned int n);
+	static ZQWORD Mix(ZQWORD h);
+};
+
+#endif
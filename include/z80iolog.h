@@ -0,0 +1,81 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_IOLOG_H_
+#define Z80_IOLOG_H_
+
+#include <vector>
+
+#include "z80.h"
+
+
+typedef struct {
+	ZQWORD tstate;
+	ZWORD port;
+	ZBYTE value;
+} Z80IOEVENT;
+
+
+/*
+ * Preallocated log of port writes for Z80::ExecuteFrame().
+ *
+ * Writes to buffered ports (matched on the low address byte, as most Z80
+ * machines decode them) are queued with their T-state instead of going
+ * through IOWriteCallback. A full log grows, so the writes of a buffered
+ * port always stay in order in the log; size it for a frame to keep the
+ * emulation loop free of allocations.
+ */
+class Z80IOLog {
+
+public:
+
+	Z80IOLog(unsigned int capacity);
+
+	void BufferPort(ZBYTE port, bool buffered = true);
+
+	inline bool IsBuffered(ZWORD port) const {
+		return ports[port & 0xff];
+	}
+
+	inline void Push(ZQWORD tstate, ZWORD port, ZBYTE value) {
+		if (count == events.size()) {
+			Grow();
+		}
+		Z80IOEVENT &ev = events[count++];
+		ev.tstate = tstate;
+		ev.port = port;
+		ev.value = value;
+	}
+
+	void Clear();
+
+	unsigned int Size() const;
+	const Z80IOEVENT *Events() const;
+	unsigned int Overflows() const;		// Times the log had to grow since Clear()
+
+private:
+
+	void Grow();
+
+	std::vector<Z80IOEVENT> events;
+	unsigned int count = 0;
+	unsigned int overflows = 0;
+	bool ports[256];
+};
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_MACHINE_H_
+#define Z80_MACHINE_H_
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "z80.h"
+
+
+// Spin-then-yield barrier, cheap enough to cross once per quantum
+class Z80Barrier {
+
+public:
+
+	Z80Barrier(unsigned int parties);
+
+	void Wait();
+
+private:
+
+	unsigned int parties;
+	std::atomic<unsigned int> waiting;
+	std::atomic<unsigned int> generation;
+};
+
+
+/*
+ * Several CPUs on one clock, kept within a quantum of each other.
+ *
+ * Every CPU runs up to the end of the current quantum, then they all meet.
+ * Threaded mode gives each CPU its own thread (the first one runs on the
+ * caller's); otherwise they run round-robin on the calling thread, which is
+ * deterministic. Device callbacks call SharedAccess() when they touch shared
+ * RAM or a mailbox: the next quantum drops to the minimum and then doubles
+ * back up to the configured size while nothing is shared.
+ */
+class Z80Machine {
+
+public:
+
+	Z80Machine();
+	~Z80Machine();
+
+	void Add(Z80 *cpu);
+
+	void SetQuantum(unsigned int ts);
+	void SetMinQuantum(unsigned int ts);
+	void SetThreaded(bool on);
+
+	void SharedAccess();
+
+	ZQWORD Run(ZQWORD tstates);
+
+	ZQWORD GetTime();
+	unsigned int GetCurrentQuantum();
+
+private:
+
+	std::vector<Z80 *> cpus;
+	std::vector<ZQWORD> offsets;		// Each CPU's clock at machine time 0
+
+	ZQWORD time = 0;
+	ZQWORD target = 0;
+
+	unsigned int quantum = 1000;
+	unsigned int min_quantum = 20;
+	unsigned int current = 1000;
+	std::atomic<bool> contention;
+
+	bool threaded = false;
+	bool stopping = false;
+	Z80Barrier *barrier = nullptr;
+	std::vector<std::thread> workers;
+
+	void RunCPU(unsigned int n);
+	bool Suspended();
+	void NextQuantum();
+	void StartThreads();
+	void StopThreads();
+};
+
+#endif
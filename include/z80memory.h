@@ -0,0 +1,100 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_MEMORY_H_
+#define Z80_MEMORY_H_
+
+#include <atomic>
+
+#include "z80.h"
+
+
+#define Z80MEM_PAGE_BITS	10
+#define Z80MEM_PAGE_SIZE	(1 << Z80MEM_PAGE_BITS)
+#define Z80MEM_PAGE_MASK	(Z80MEM_PAGE_SIZE - 1)
+#define Z80MEM_PAGES		((0xffff + 1) >> Z80MEM_PAGE_BITS)
+
+
+// Reference counted page. A page with more than one reference is shared and
+// gets copied on the first write.
+typedef struct {
+	std::atomic<int> refs;
+	ZBYTE data[Z80MEM_PAGE_SIZE];
+} Z80PAGE;
+
+
+/*
+ * Paged 64 KB address space with copy-on-write pages.
+ *
+ * Plug it into a core built with __Z80MEMCALLBACKS__ through Attach(). An
+ * instance is either running (only its emulation thread touches the page
+ * table) or parked (background passes like Z80PageDedup may remap pages).
+ */
+class Z80Memory {
+
+friend class Z80PageDedup;
+
+public:
+
+	Z80Memory();
+	~Z80Memory();
+
+	Z80Memory(const Z80Memory &) = delete;
+	Z80Memory &operator=(const Z80Memory &) = delete;
+
+	inline ZBYTE Read(ZWORD addr) {
+		return pages[addr >> Z80MEM_PAGE_BITS]->data[addr & Z80MEM_PAGE_MASK];
+	}
+
+	inline void Write(ZWORD addr, ZBYTE val) {
+		Z80PAGE *page = pages[addr >> Z80MEM_PAGE_BITS];
+		if (page->refs.load(std::memory_order_relaxed) != 1) {
+			page = Unshare(addr >> Z80MEM_PAGE_BITS);
+		}
+		page->data[addr & Z80MEM_PAGE_MASK] = val;
+	}
+
+	void Load(ZWORD addr, const ZBYTE *src, unsigned int len);
+	void Save(ZWORD addr, ZBYTE *dst, unsigned int len);
+	void Fill(ZBYTE val);
+	void Fill(ZWORD addr, ZBYTE val, unsigned int len);
+	void Copy(ZWORD dst, ZWORD src, unsigned int len);
+
+	unsigned int SharedPages();
+
+	void Park();
+	void Unpark();
+
+#ifdef __Z80MEMCALLBACKS__
+	void Attach(Z80 *cpu);
+#endif
+
+private:
+
+	enum { RUNNING = 0, PARKED = 1, REMAPPING = 2 };
+
+	Z80PAGE *pages[Z80MEM_PAGES];
+	std::atomic<int> state;
+
+	Z80PAGE *Unshare(int index);
+
+	static Z80PAGE *NewPage();
+	static void ReleasePage(Z80PAGE *page);
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_PACER_H_
+#define Z80_PACER_H_
+
+#include "z80.h"
+
+
+#define Z80PACER_BUCKETS	16		// Wake error histogram, bucket n counts errors < 2^n us
+
+
+typedef struct {
+	ZQWORD waits;			// Pace() calls that had to wait
+	ZQWORD late;			// Pace() calls that found the deadline already gone
+	ZQWORD resyncs;			// Times we fell more than the max lag behind and gave up catching up
+	long long min_error;	// Wake error in ns, actual minus target (positive = overslept)
+	long long max_error;
+	double mean_error;
+	double m2_error;		// Running sum of squares, see StdDev()
+	ZQWORD histogram[Z80PACER_BUCKETS];
+} Z80PACERSTATS;
+
+
+/*
+ * Keeps a CPU in step with CLOCK_MONOTONIC at a given frequency.
+ *
+ * Every deadline is computed from a fixed base, so an oversleep is paid back
+ * on the next slice instead of accumulating. Waits sleep until a spin
+ * threshold before the deadline and busy-wait the rest; a halted CPU only
+ * sleeps. Turbo mode never waits and rebases the clock when switched off.
+ */
+class Z80Pacer {
+
+public:
+
+	Z80Pacer(Z80 *cpu, ZQWORD hz);
+
+	void SetSpinThreshold(ZQWORD ns);
+	void SetMaxLag(ZQWORD ns);
+	void SetTurbo(bool on);
+	void SetHaltSleep(bool on);
+
+	unsigned int Run(unsigned int ts);
+	void Pace();
+	void Resync();
+
+	const Z80PACERSTATS &GetStats();
+	double StdDev();
+	void ClearStats();
+
+private:
+
+	Z80 *cpu;
+	ZQWORD hz;
+
+	ZQWORD base_ns;
+	ZQWORD base_clock;
+
+	ZQWORD spin_threshold = 200000;
+	ZQWORD max_lag = 50000000;
+	bool turbo = false;
+	bool halt_sleep = true;
+
+	Z80PACERSTATS stats;
+
+	void Record(long long error);
+
+	static ZQWORD Now();
+	static void SleepUntil(ZQWORD ns);
+};
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_PORTS_H_
+#define Z80_PORTS_H_
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "z80.h"
+#include "z80iolog.h"
+
+
+#define Z80PORTS_UNROUTED	-1		// Writes to the port are ignored
+
+// What an OUT does when the device's ring is full
+#define Z80PORTS_BLOCK		0		// Waits for the device thread to make room
+#define Z80PORTS_SYNC		1		// Goes to the device's fallback on the CPU thread, ahead of the queued ones
+#define Z80PORTS_DROP		2		// Lost, see Dropped()
+
+
+/*
+ * Bounded single-producer / single-consumer ring, lock free.
+ *
+ * Capacity is rounded up to a power of two. Each side keeps a private copy
+ * of the other side's index and only reloads the shared one when the copy
+ * says full (or empty), so the common case touches no shared cache line
+ * but its own.
+ */
+template <typename T>
+class Z80SPSC {
+
+public:
+
+	Z80SPSC(unsigned int capacity) {
+		unsigned int size = 1;
+		while (size < capacity) {
+			size <<= 1;
+		}
+		items.resize(size);
+		mask = size - 1;
+		head.store(0);
+		tail.store(0);
+	}
+
+	// Producer side. Returns false if full, never blocks.
+	inline bool Push(const T &item) {
+		unsigned int t = tail.load(std::memory_order_relaxed);
+		if (t - head_cache > mask) {
+			head_cache = head.load(std::memory_order_acquire);
+			if (t - head_cache > mask) {
+				return false;
+			}
+		}
+		items[t & mask] = item;
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. Returns false if empty.
+	inline bool Pop(T &item) {
+		unsigned int h = head.load(std::memory_order_relaxed);
+		if (h == tail_cache) {
+			tail_cache = tail.load(std::memory_order_acquire);
+			if (h == tail_cache) {
+				return false;
+			}
+		}
+		item = items[h & mask];
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Either side, exact only when the other side is idle
+	unsigned int Size() const {
+		return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+	}
+
+	unsigned int Capacity() const {
+		return mask + 1;
+	}
+
+private:
+
+	std::vector<T> items;
+	unsigned int mask;
+
+	// Padded so each side's index lives on its own cache line
+	char pad0[64];
+	std::atomic<unsigned int> head;		// Written by the consumer
+	unsigned int tail_cache = 0;
+	char pad1[64];
+	std::atomic<unsigned int> tail;		// Written by the producer
+	unsigned int head_cache = 0;
+	char pad2[64];
+};
+
+
+/*
+ * Port I/O between the emulation thread and device threads without locks.
+ *
+ * OUTs are queued with their T-state on the ring of the device the port is
+ * routed to (matched on the low address byte), one ring per device thread.
+ * Size the rings for the worst burst between two drains: by default an OUT
+ * that finds the ring full goes to the device's fallback on the CPU thread,
+ * or is dropped if there is none, so the CPU never waits. Z80PORTS_BLOCK
+ * makes it wait for the device thread instead, which stalls emulation (and
+ * never returns if that thread is gone). INs return a per-port latch the
+ * device thread keeps up to date with SetLatch().
+ */
+class Z80Ports {
+
+public:
+
+	typedef std::function<void(const Z80IOEVENT &)> FALLBACK;
+
+	Z80Ports(Z80 *cpu);
+	~Z80Ports();
+
+	int AddDevice(unsigned int capacity = 4096, int policy = Z80PORTS_SYNC, FALLBACK fallback = nullptr);
+	void Route(ZBYTE port, int device);
+
+	// Device thread side
+	void SetLatch(ZBYTE port, ZBYTE value);
+	bool Pop(int device, Z80IOEVENT &ev);
+
+	ZQWORD Dropped(int device);
+	ZQWORD Overflows(int device);
+
+private:
+
+	typedef struct {
+		Z80SPSC<Z80IOEVENT> *ring;
+		int policy;					// Z80PORTS_BLOCK / SYNC / DROP
+		FALLBACK fallback;
+		std::atomic<ZQWORD> dropped;
+		std::atomic<ZQWORD> overflows;	// Writes that found the ring full
+	} DEVICE;
+
+	Z80 *cpu;
+	std::vector<DEVICE *> devices;
+	int routes[256];
+	std::atomic<ZBYTE> latches[256];
+
+	ZBYTE IORead(ZWORD port);
+	void IOWrite(ZWORD port, ZBYTE value);
+};
+
+#endif
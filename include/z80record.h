@@ -0,0 +1,163 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_RECORD_H_
+#define Z80_RECORD_H_
+
+#include <stddef.h>
+#include <vector>
+
+#include "z80.h"
+
+
+// Event kinds, low 3 bits of the leading varint (T-state delta << 3 | kind)
+#define Z80REC_IN		0		// Value byte, same port as the previous IN
+#define Z80REC_INPORT	1		// Port word then value byte
+#define Z80REC_INT		2		// Byte read on the acknowledge
+#define Z80REC_NMI		3
+#define Z80REC_STALL	4		// Varint T-states of WAIT / BUSREQ
+#define Z80REC_INTVEC	5		// Byte read on the acknowledge, then the address word of an IM 0 CALL / JP
+
+
+/*
+ * Logs everything a CPU takes from outside: the value of every IN, and the
+ * T-state of every INT / NMI acceptance and WAIT / BUSREQ stall.
+ *
+ * Events go into a byte stream as varint T-state deltas, so most of them
+ * take 2 to 4 bytes. Start() begins at the CPU's current clock; save its
+ * state then too, replaying starts from it. Memory mapped devices (memory
+ * callbacks) aren't recorded.
+ */
+class Z80Recorder {
+
+public:
+
+	Z80Recorder();
+
+	void Start(Z80 *cpu);
+	void Stop();
+
+	inline void In(ZQWORD tstate, ZWORD port, ZBYTE value) {
+		if (port == last_port) {
+			Event(tstate, Z80REC_IN);
+		} else {
+			Event(tstate, Z80REC_INPORT);
+			stream.push_back(port & 0xff);
+			stream.push_back(port >> 8);
+			last_port = port;
+		}
+		stream.push_back(value);
+	}
+
+	inline void Interrupt(ZQWORD tstate, ZBYTE data) {
+		Event(tstate, Z80REC_INT);
+		stream.push_back(data);
+	}
+
+	inline void Interrupt(ZQWORD tstate, ZBYTE data, ZWORD address) {
+		Event(tstate, Z80REC_INTVEC);
+		stream.push_back(data);
+		stream.push_back(address & 0xff);
+		stream.push_back(address >> 8);
+	}
+
+	inline void NMI(ZQWORD tstate) {
+		Event(tstate, Z80REC_NMI);
+	}
+
+	inline void Stall(ZQWORD tstate, unsigned int ts) {
+		Event(tstate, Z80REC_STALL);
+		Varint(ts);
+	}
+
+	const std::vector<ZBYTE> &GetStream();
+	ZQWORD GetEvents();
+
+private:
+
+	Z80 *cpu = nullptr;
+	std::vector<ZBYTE> stream;
+	ZQWORD last_tstate = 0;
+	ZWORD last_port = 0;
+	ZQWORD events = 0;
+
+	inline void Event(ZQWORD tstate, ZBYTE kind) {
+		Varint(((tstate - last_tstate) << 3) | kind);
+		last_tstate = tstate;
+		events++;
+	}
+
+	inline void Varint(ZQWORD val) {
+		while (val >= 0x80) {
+			stream.push_back((val & 0x7f) | 0x80);
+			val >>= 7;
+		}
+		stream.push_back(val);
+	}
+};
+
+
+/*
+ * Feeds a recorded stream back to a CPU restored to the state it had when
+ * recording started, no devices needed.
+ *
+ * Takes over the CPU's IN and INT acknowledge callbacks (async reads are
+ * turned off). ExecuteTStates() stops at every recorded acceptance to raise
+ * the interrupt right there, and the acknowledge drops the INT line again.
+ * INs that don't match the recorded port and T-state, and reads past the
+ * end of the stream, count as mismatches: the run has diverged.
+ */
+class Z80Replayer {
+
+public:
+
+	Z80Replayer(Z80 *cpu, const ZBYTE *stream, size_t size);
+
+	unsigned int ExecuteTStates(unsigned int ts);
+
+	bool Finished();
+	ZQWORD GetMismatches();
+
+private:
+
+	typedef struct {
+		size_t pos;
+		ZQWORD tstate;
+		ZWORD port;
+		ZBYTE kind;
+		ZBYTE value;
+		unsigned int stall;
+	} CURSOR;
+
+	Z80 *cpu;
+	const ZBYTE *stream;
+	size_t size;
+
+	CURSOR in;			// Next IN
+	CURSOR irq;			// Next acceptance or stall
+	bool in_valid;
+	bool irq_valid;
+	ZBYTE ack[3] = {0xff, 0xff, 0xff};	// Bytes for the acknowledge of the INT just raised
+	int ack_pos = 0;
+	ZQWORD mismatches = 0;
+
+	bool Next(CURSOR &cursor, bool want_in);
+	ZBYTE Read(ZWORD port);
+	ZBYTE Acknowledge();
+};
+
+#endif
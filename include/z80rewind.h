@@ -0,0 +1,92 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_REWIND_H_
+#define Z80_REWIND_H_
+
+#include <stddef.h>
+#include <vector>
+
+#include "z80.h"
+
+
+#define Z80REWIND_PAGE_BITS	8
+#define Z80REWIND_PAGE_SIZE	(1 << Z80REWIND_PAGE_BITS)
+#define Z80REWIND_PAGES		((0xffff + 1) >> Z80REWIND_PAGE_BITS)
+
+// Z80STATE up to the address space
+#define Z80REWIND_HEADER	offsetof(Z80STATE, memory)
+
+
+/*
+ * Bounded ring of checkpoints to step back in time.
+ *
+ * Checkpoint() (once per frame, say) stores the CPU state and the pages
+ * written since the previous checkpoint, found by comparing against a copy
+ * of memory taken then. Every keyframe_interval checkpoints all pages are
+ * stored, so a restore applies at most that many deltas. When the ring is
+ * full the oldest keyframe goes together with its deltas.
+ *
+ * Seek() loads the last checkpoint at or before a T-state and runs forward
+ * to it; checkpoints after it are dropped, a new timeline starts there.
+ * Devices see the I/O of the re-executed part again. The CPU must run on
+ * its memory array, not on memory callbacks.
+ */
+class Z80Rewind {
+
+public:
+
+	Z80Rewind(Z80 *cpu, unsigned int capacity, unsigned int keyframe_interval = 16);
+	~Z80Rewind();
+
+	Z80Rewind(const Z80Rewind &) = delete;
+	Z80Rewind &operator=(const Z80Rewind &) = delete;
+
+	void Checkpoint();
+	int Seek(ZQWORD clock);
+	void Clear();
+
+	unsigned int GetCheckpoints();
+	ZQWORD GetOldest();
+	ZQWORD GetBytes();
+
+private:
+
+	typedef struct {
+		ZQWORD clock;
+		bool keyframe;
+		ZBYTE state[Z80REWIND_HEADER];
+		std::vector<ZBYTE> index;		// Pages stored, in data order
+		std::vector<ZBYTE> data;
+	} ENTRY;
+
+	Z80 *cpu;
+	unsigned int keyframe_interval;
+
+	std::vector<ENTRY> ring;
+	unsigned int first = 0;
+	unsigned int count = 0;
+	unsigned int since_keyframe = 0;
+
+	Z80STATE *current;		// Scratch for SaveState()
+	Z80STATE *previous;		// Memory as of the newest checkpoint
+
+	ENTRY &At(unsigned int n);
+	void Restore(unsigned int n);
+};
+
+#endif
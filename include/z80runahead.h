@@ -0,0 +1,102 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef Z80_RUNAHEAD_H_
+#define Z80_RUNAHEAD_H_
+
+#include <functional>
+
+#include "z80.h"
+#include "z80iolog.h"
+
+
+#define Z80RUNAHEAD_LOG		4096	// Port writes the log starts with room for, it grows
+
+
+typedef struct {
+	ZQWORD frames;
+	unsigned int ahead;			// Frames run ahead by the last Frame()
+	ZQWORD latency_saved;		// T-states the shown output is ahead of the real CPU, last frame
+
+	ZQWORD frame_ns;			// Last frame: the real one
+	ZQWORD ahead_ns;			// The speculative ones
+	ZQWORD state_ns;			// SaveState() and LoadState()
+
+	ZQWORD total_frame_ns;
+	ZQWORD total_ahead_ns;
+	ZQWORD total_state_ns;
+} Z80RUNAHEADSTATS;
+
+
+/*
+ * Run-ahead: shows the output of a few frames into the future, computed
+ * with the input as it is now, to hide the frames of lag most programs have
+ * between reading input and drawing its effect.
+ *
+ * Frame() runs one real frame, saves the state, runs ahead frames more,
+ * calls the present callback and loads the state back. Port writes of the
+ * speculative frames go to a log (GetAheadLog() has the last one's), never
+ * to the devices: the log grows past Z80RUNAHEAD_LOG when it must. An
+ * attached Z80Recorder, Z80IRQSTATS and Z80SharedState are detached while
+ * speculating, so they only see the real frames. The frame callback runs
+ * before every frame, real or not: raise the frame interrupt there.
+ * The CPU must run on its memory array. Only the pages the speculative
+ * frames wrote are copied back, so the host's own writes to memory from the
+ * frame callback must go through MarkDirty().
+ *
+ * Port reads still go to the devices while speculating. Reads with side
+ * effects (a FIFO popped, a latch cleared on read) then happen again in the
+ * real frame, so such devices must answer from state they don't change on
+ * a read, or the host has to keep them out of the speculative frames.
+ */
+class Z80RunAhead {
+
+public:
+
+	Z80RunAhead(Z80 *cpu, unsigned int frame_tstates, unsigned int ahead = 1);
+	~Z80RunAhead();
+
+	Z80RunAhead(const Z80RunAhead &) = delete;
+	Z80RunAhead &operator=(const Z80RunAhead &) = delete;
+
+	void SetAhead(unsigned int frames);
+	void SetFrameCallback(std::function<void(Z80 *)> cb);
+	void SetPresentCallback(std::function<void(Z80 *)> cb);
+
+	void Frame();
+
+	const Z80IOLog &GetAheadLog();
+	const Z80RUNAHEADSTATS &GetStats();
+	void ClearStats();
+
+private:
+
+	Z80 *cpu;
+	unsigned int frame_tstates;
+	unsigned int ahead;
+
+	Z80STATE *state;
+	Z80IOLog log;
+	Z80RUNAHEADSTATS stats;
+
+	std::function<void(Z80 *)> FrameCallback;
+	std::function<void(Z80 *)> PresentCallback;
+
+	static ZQWORD Now();
+};
+
+#endif
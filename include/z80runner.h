@@ -0,0 +1,128 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_RUNNER_H_
+#define Z80_RUNNER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "z80.h"
+
+
+#define Z80JOB_QUEUED	0
+#define Z80JOB_RUNNING	1
+#define Z80JOB_PARKED	2		// Halted with nothing pending, back on Wake()
+#define Z80JOB_DONE		3		// Ran out of its cycle or I/O quota
+
+
+typedef struct {
+	int state;				// Z80JOB_*
+	ZQWORD tstates;			// Run so far
+	ZQWORD io;				// IN / OUT cycles so far
+	ZQWORD slices;
+	ZQWORD steals;			// Slices run by a worker that stole the job
+} Z80JOBSTATS;
+
+
+/*
+ * Runs many independent CPUs on a fixed pool of worker threads.
+ *
+ * Every worker owns a deque of jobs, runs the one at the front for a slice
+ * and puts it back at the end. A worker with an empty deque steals from the
+ * back of the others'. Jobs end when they use up their cycle or I/O quota
+ * (0 means no limit), and are parked when a slice leaves them halted with
+ * no interrupt that could wake them.
+ *
+ * The last slice is cut short to end on the cycle quota, the I/O quota is
+ * only checked between slices: a job can go past it by up to slice / 11
+ * I/O cycles (OUT (n),A being the shortest), pick a small slice for a
+ * tight one.
+ *
+ * Only the worker running a job may touch its CPU. Use Wake() to raise
+ * interrupts or poke devices: the function runs on the worker right before
+ * the job's next slice, and a parked job is queued again.
+ */
+class Z80Runner {
+
+public:
+
+	typedef std::function<void(Z80 *)> WAKEFUNCTION;
+
+	Z80Runner(unsigned int threads = 0);
+	~Z80Runner();
+
+	int Add(Z80 *cpu, unsigned int slice = 10000, ZQWORD cycle_quota = 0, ZQWORD io_quota = 0);
+	void Wake(int id, WAKEFUNCTION fn = nullptr);
+
+	void Start();
+	void Wait();
+	void Stop();
+
+	Z80JOBSTATS GetStats(int id);
+	unsigned int GetThreads();
+
+private:
+
+	typedef struct {
+		Z80 *cpu;
+		unsigned int slice;
+		ZQWORD cycle_quota;
+		ZQWORD io_quota;
+		ZQWORD start_clock;
+		ZQWORD start_io;
+
+		std::mutex lock;			// Guards state, stats and posted
+		Z80JOBSTATS stats;
+		std::vector<WAKEFUNCTION> posted;
+	} JOB;
+
+	typedef struct {
+		std::mutex lock;
+		std::deque<JOB *> jobs;
+	} QUEUE;
+
+	unsigned int threads;
+	std::vector<QUEUE *> queues;
+	std::vector<JOB *> jobs;
+	std::mutex jobs_lock;
+	std::vector<std::thread> workers;
+	unsigned int next_queue = 0;
+
+	std::atomic<int> queued;		// Jobs sitting in a deque
+	std::atomic<int> runnable;		// Queued or running
+	std::atomic<int> sleepers;
+	std::atomic<bool> stopping;
+
+	std::mutex idle_lock;
+	std::condition_variable work;
+	std::condition_variable idle;
+
+	void Worker(unsigned int self);
+	JOB *Take(unsigned int self, bool &stolen);
+	void RunSlice(JOB *job);
+	void Push(unsigned int queue, JOB *job);
+	void Retire();
+};
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_SCHEDULER_H_
+#define Z80_SCHEDULER_H_
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "z80.h"
+
+
+#define Z80_NEVER	(~(ZQWORD) 0)
+
+
+// Rational conversion between the CPU clock and a device clock
+class Z80ClockDomain {
+
+public:
+
+	Z80ClockDomain(ZQWORD cpu_hz, ZQWORD device_hz);
+
+	ZQWORD ToCPU(ZQWORD ticks) const;		// Rounds up, events never fire early
+	ZQWORD ToDevice(ZQWORD tstates) const;	// Rounds down
+
+private:
+
+	ZQWORD num;
+	ZQWORD den;
+};
+
+
+/*
+ * Min-heap of device events on the CPU's 64-bit T-state clock.
+ *
+ * Run() executes instructions up to the earliest deadline, fires every due
+ * event in time order (same-time events in scheduling order) and goes on.
+ * Callbacks get the absolute time they were scheduled for and may schedule
+ * further events.
+ */
+class Z80Scheduler {
+
+public:
+
+	typedef std::function<void(ZQWORD)> EVENTCALLBACK;
+
+	Z80Scheduler(Z80 *cpu);
+
+	int At(ZQWORD when, EVENTCALLBACK cb);
+	int At(const Z80ClockDomain &domain, ZQWORD ticks, EVENTCALLBACK cb);
+	int In(ZQWORD tstates, EVENTCALLBACK cb);
+	void Cancel(int id);
+
+	ZQWORD Next();
+
+	ZQWORD Run(ZQWORD tstates);
+	ZQWORD RunUntil(ZQWORD when);
+
+private:
+
+	typedef struct {
+		ZQWORD when;
+		ZQWORD seq;
+		int id;
+	} EVENT;
+
+	Z80 *cpu;
+
+	std::vector<EVENT> heap;
+	std::unordered_map<int, EVENTCALLBACK> callbacks;
+	ZQWORD seq = 0;
+	int last_id = 0;
+
+	void Fire(ZQWORD now);
+	void Drop();
+
+	static bool Later(const EVENT &a, const EVENT &b);
+};
+
+#endif
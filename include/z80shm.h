@@ -0,0 +1,96 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef Z80_SHM_H_
+#define Z80_SHM_H_
+
+#include <atomic>
+
+#include "z80.h"
+
+
+#define Z80SHM_MAGIC	0x5338305a	// "Z80S"
+#define Z80SHM_VERSION	1
+
+
+// Register block as seen by observers. Plain words, no unions, so the layout
+// doesn't depend on how the emulator was built.
+typedef struct {
+	ZWORD af, bc, de, hl;
+	ZWORD alt_af, alt_bc, alt_de, alt_hl;
+	ZWORD ix, iy, sp, pc, ir, wz;
+	ZBYTE iff1, iff2, im, halted;
+} Z80SHMREGISTERS;
+
+
+typedef struct {
+	unsigned int magic;
+	unsigned int version;
+	std::atomic<unsigned int> sequence;	// Odd while the emulation thread is publishing
+	unsigned int reserved;
+	Z80SHMREGISTERS regs;
+	alignas(64) Z80ADDRESSBUS memory;
+} Z80SHMBLOCK;
+
+
+/*
+ * Machine state (registers + 64 KB address space) living in a memfd region.
+ *
+ * The emulation side calls Create() and Attach(). The CPU keeps running on
+ * its own memory; at the end of every ExecuteXXX() call it publishes its
+ * registers and the pages it wrote during the call, inside a short seqlock
+ * write section. Observers Open() the same fd (or /proc/<pid>/fd/<n>)
+ * read-only and use Snapshot(), which retries, backing off, until it gets a
+ * copy no publication overlapped. Nothing on the emulation side ever waits.
+ * Host writes straight to cpu->memory are published once given to
+ * Z80::MarkDirty(). One CPU is attached at a time; Close() and the
+ * destructor detach it.
+ */
+class Z80SharedState {
+
+public:
+
+	Z80SharedState();
+	~Z80SharedState();
+
+	int Create(const char *name);
+	int Open(int fd);
+	int Open(const char *path);
+	void Close();
+
+	int GetFd();
+	ZBYTE *GetMemory();
+
+	void Attach(Z80 *cpu);
+	void Detach(Z80 *cpu);
+
+	void Publish(Z80 *cpu);
+
+	int Snapshot(Z80SHMREGISTERS *regs, ZBYTE *memory, unsigned int retries = 1000);
+
+private:
+
+	Z80SHMBLOCK *block = nullptr;
+	int fd = -1;
+	bool owner = false;
+	Z80 *attached = nullptr;		// Detached by Close()
+
+	int Map(bool writable);
+};
+
+#endif
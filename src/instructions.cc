@@ -453,7 +453,7 @@ void Z80::BIT_n_R() {
 
 void Z80::BIT_n_off() {
 
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZWORD addr = PAIR(OP2) + offset;
 
 	ZBYTE result = READBYTE(addr) & (1 << OP1);
@@ -477,7 +477,7 @@ void Z80::CALL() {
 	pc += 2;
 	/* Push */
 	reg.w.sp -= 2;
-	WRITEWORD(reg.w.sp, pc);
+	PUSHWORD(reg.w.sp, pc);
 	/* Push */
 	pc = addr;
 	reg.w.wz = pc;
@@ -489,7 +489,7 @@ void Z80::CALL_cond() {
 	if (Condition(OP1)) {
 		/* Push */
 		reg.w.sp -= 2;
-		WRITEWORD(reg.w.sp, pc);
+		PUSHWORD(reg.w.sp, pc);
 		/* Push */
 		pc = addr;
 	}
@@ -546,7 +546,7 @@ void Z80::CPDR() {
 	}
 	MODFLAG(FLAG_Y, value & (1 << 1));
 	MODFLAG(FLAG_X, value & (1 << 3));
-	if (reg.b.a == READBYTE(reg.w.hl) || reg.w.bc == 1) {
+	if (reg.b.a == PEEKBYTE(reg.w.hl) || reg.w.bc == 1) {
 		reg.w.wz = reg.w.wz + 1;
 	} else {
 		reg.w.wz = pc - 1;
@@ -591,7 +591,7 @@ void Z80::CPIR() {
 	MODFLAG(FLAG_C, carry);
 	MODFLAG(FLAG_Y, value & (1 << 1));
 	MODFLAG(FLAG_X, value & (1 << 3));
-	if (reg.b.a == READBYTE(reg.w.hl) || reg.w.bc == 1) {
+	if (reg.b.a == PEEKBYTE(reg.w.hl) || reg.w.bc == 1) {
 		reg.w.wz = reg.w.wz + 1;
 	} else {
 		reg.w.wz = pc + 1;
@@ -686,7 +686,6 @@ void Z80::DEC_off() {
 
 void Z80::DI() {
 	iff1 = iff2 = 0;
-	defer_irq = 1;
 }
 
 void Z80::DJNZ() {
@@ -700,7 +699,7 @@ void Z80::DJNZ() {
 
 void Z80::EI() {
 	iff1 = iff2 = 1;
-	defer_irq = 1;
+	events |= Z80EVENT_EI;
 }
 
 void Z80::EXX() {
@@ -729,13 +728,13 @@ void Z80::EX_RR_RR() {
 
 void Z80::EX_SP_RR() {
 	ZWORD tmp = READWORD(reg.w.sp);
-	WRITEWORD(reg.w.sp, PAIR(OP2));
+	PUSHWORD(reg.w.sp, PAIR(OP2));
 	PAIR(OP2) = tmp;
 	reg.w.wz = PAIR(OP2);
 }
 
 void Z80::HALT() {
-	halted = 1;
+	events |= Z80EVENT_HALT;
 	pc--;
 }
 
@@ -1020,7 +1019,7 @@ void Z80::LD_addr_R() {
 	ZWORD addr = READWORD(pc);
 	WRITEBYTE(addr, REG(OP2));
 	reg.b.w = REG(OP1);
-	reg.b.z = READBYTE(addr + 1) & 0xff;
+	reg.b.z = (addr + 1) & 0xff;
 	pc += 2;
 }
 
@@ -1192,7 +1191,7 @@ void Z80::POP() {
 void Z80::PUSH() {
 	/* Push */
 	reg.w.sp -= 2;
-	WRITEWORD(reg.w.sp, PAIR(OP1));
+	PUSHWORD(reg.w.sp, PAIR(OP1));
 	/* Push */
 }
 
@@ -1205,13 +1204,13 @@ void Z80::RES_n_R() {
 }
 
 void Z80::RES_n_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	WRITEBYTE(PAIR(OP2) + offset, (READBYTE(PAIR(OP2) + offset) & ~(1 << OP1)));
 	reg.w.wz = PAIR(OP2) + offset;
 }
 
 void Z80::RES_n_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	REG(OP3) = (READBYTE(PAIR(OP2) + offset) & ~(1 << OP1));
 	WRITEBYTE(PAIR(OP2) + offset, REG(OP3));
 	reg.w.wz = PAIR(OP2) + offset;
@@ -1222,6 +1221,10 @@ void Z80::RET() {
 	reg.w.sp += 2;
 	pc = value;
 	reg.w.wz = pc;
+
+	if (irqstats) {
+		IRQReturn();
+	}
 }
 
 void Z80::RETI() {
@@ -1231,6 +1234,12 @@ void Z80::RETI() {
 	reg.w.sp += 2;
 	pc = value;
 	reg.w.wz = pc;
+
+	if (irqstats) {
+		IRQReturn();
+	}
+
+	RETICallback();
 }
 
 void Z80::RETN() {
@@ -1238,6 +1247,10 @@ void Z80::RETN() {
 	ZWORD value = READWORD(reg.w.sp);
 	reg.w.sp += 2;	
 	pc = value;
+
+	if (irqstats) {
+		IRQReturn();
+	}
 }
 
 void Z80::RET_cond() {
@@ -1245,6 +1258,10 @@ void Z80::RET_cond() {
 		ZWORD value = READWORD(reg.w.sp);
 		reg.w.sp += 2;
 		pc = value;
+
+		if (irqstats) {
+			IRQReturn();
+		}
 	}
 	reg.w.wz = pc;
 }
@@ -1268,7 +1285,7 @@ void Z80::RLC_R() {
 }
 
 void Z80::RLC_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RLC(1, value)
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1276,7 +1293,7 @@ void Z80::RLC_off() {
 }
 
 void Z80::RLC_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RLC(1, value);
 	REG(OP2) = value;
@@ -1308,7 +1325,7 @@ void Z80::RL_R() {
 }
 
 void Z80::RL_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RL(1, value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1316,7 +1333,7 @@ void Z80::RL_off() {
 }
 
 void Z80::RL_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RL(1, value);
 	REG(OP2) = value;
@@ -1343,7 +1360,7 @@ void Z80::RRC_R() {
 }
 
 void Z80::RRC_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RRC(1, value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1351,7 +1368,7 @@ void Z80::RRC_off() {
 }
 
 void Z80::RRC_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RRC(1, value);
 	REG(OP2) = value;
@@ -1382,7 +1399,7 @@ void Z80::RR_R() {
 }
 
 void Z80::RR_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RR(1, value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1390,7 +1407,7 @@ void Z80::RR_off() {
 }
 
 void Z80::RR_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	RR(1, value);
 	REG(OP2) = value;
@@ -1401,7 +1418,7 @@ void Z80::RR_off_R() {
 void Z80::RST() {
 	/* Push */
 	reg.w.sp -= 2;
-	WRITEWORD(reg.w.sp, pc);
+	PUSHWORD(reg.w.sp, pc);
 	/* Push */
 	pc = OP1;
 	reg.w.wz = pc;
@@ -1518,13 +1535,13 @@ void Z80::SET_n_R() {
 }
 
 void Z80::SET_n_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	WRITEBYTE(PAIR(OP2) + offset, (READBYTE(PAIR(OP2) + offset) | (1 << OP1)));
 	reg.w.wz = PAIR(OP2) + offset;
 }
 
 void Z80::SET_n_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	REG(OP3) = (READBYTE(PAIR(OP2) + offset) | (1 << OP1));
 	WRITEBYTE(PAIR(OP2) + offset, REG(OP3));
 	reg.w.wz = PAIR(OP2) + offset;
@@ -1541,7 +1558,7 @@ void Z80::SLA_R() {
 }
 
 void Z80::SLA_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SLA(value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1549,7 +1566,7 @@ void Z80::SLA_off() {
 }
 
 void Z80::SLA_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SLA(value);
 	REG(OP2) = value;
@@ -1568,7 +1585,7 @@ void Z80::SLL_R() {
 }
 
 void Z80::SLL_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SLL(value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1576,7 +1593,7 @@ void Z80::SLL_off() {
 }
 
 void Z80::SLL_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SLL(value);
 	REG(OP2) = value;
@@ -1595,14 +1612,14 @@ void Z80::SRA_R() {
 }
 
 void Z80::SRA_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SRA(value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
 }
 
 void Z80::SRA_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SRA(value);
 	REG(OP2) = value;
@@ -1620,7 +1637,7 @@ void Z80::SRL_R() {
 }
 
 void Z80::SRL_off() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SRL(value);
 	WRITEBYTE(PAIR(OP1) + offset, value);
@@ -1628,7 +1645,7 @@ void Z80::SRL_off() {
 }
 
 void Z80::SRL_off_R() {
-	char offset = READBYTE(pc++ - 1);
+	char offset = PEEKBYTE(pc++ - 1);
 	ZBYTE value = READBYTE(PAIR(OP1) + offset);
 	SRL(value);
 	REG(OP2) = value;
@@ -16,77 +16,72 @@
  */
 
 
+#include <algorithm>
+#include <string.h>
+
 #include "z80.h"
+#include "z80shm.h"
+#include "z80iolog.h"
+#include "z80record.h"
+
 
+#ifdef __Z80BUSTIMING__
+#define BUSGAPS() bus_gaps = bus_gap_table[i_set][op]
+#else
+#define BUSGAPS()
+#endif
 
 #define CHECKJUMP() \
 { \
-	tstates_counter = a_set[i_set][op].tstates_nojmp; \
-	mcycles_counter = a_set[i_set][op].mcycles_nojmp; \
-	last_mcycle_tstates = a_set[i_set][op].last_mc_tstates_nojmp; \
-	switch (a_set[i_set][op].checkjump) { \
+	const ARGUMENTS &args = a_set[i_set][op]; \
+	BUSGAPS(); \
+	bool jump = false; \
+	tstates_counter = args.tstates_nojmp; \
+	mcycles_counter = args.mcycles_nojmp; \
+	last_mcycle_tstates = args.last_mc_tstates_nojmp; \
+	switch (args.checkjump) { \
 		case 1: \
-			if (Condition(a_set[i_set][op].operand1)) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = Condition(args.operand1); \
 			break; \
 		case 2: \
-			if (reg.b.b - 1) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = (reg.b.b - 1) != 0; \
 			break; \
 		case 3:	\
-			if ((reg.w.bc - 1) != 0) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = (reg.w.bc - 1) != 0; \
 			break; \
 		case 4:	\
-			if ((reg.w.bc - 1) != 0 && (reg.b.a - READBYTE(reg.w.hl)) != 0) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = (reg.w.bc - 1) != 0 && (reg.b.a - PEEKBYTE(reg.w.hl)) != 0; \
 			break; \
 		case 5:	\
-			if ((reg.b.b - 1) != 0 && (reg.b.a - READBYTE(reg.w.hl)) != 0) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = (reg.b.b - 1) != 0 && (reg.b.a - PEEKBYTE(reg.w.hl)) != 0; \
 			break; \
 		case 6:	\
-			if ((reg.b.b - 1) != 0) { \
-				will_jump = 1; \
-				tstates_counter = a_set[i_set][op].tstates; \
-				mcycles_counter = a_set[i_set][op].mcycles; \
-				last_mcycle_tstates = a_set[i_set][op].last_mc_tstates; \
-			} \
+			jump = (reg.b.b - 1) != 0; \
 			break; \
 	} \
+	if (jump) { \
+		will_jump = 1; \
+		tstates_counter = args.tstates; \
+		mcycles_counter = args.mcycles; \
+		last_mcycle_tstates = args.last_mc_tstates; \
+	} \
 }
 
 
+// Placeholders are bound with lambdas: a captured this fits std::function's
+// inline storage, where a std::bind of a member function gets heap allocated
+
 Z80::Z80() {
-	SetIOReadCallback(std::bind(&Z80::IOReadPlaceholder, this, std::placeholders::_1));
-	SetIOWriteCallback(std::bind(&Z80::IOWritePlaceholder, this, std::placeholders::_1, std::placeholders::_2));
+	SetIOReadCallback([this](ZWORD addr) { return IOReadPlaceholder(addr); });
+	SetIOWriteCallback([this](ZWORD addr, ZBYTE data) { IOWritePlaceholder(addr, data); });
+	SetIRQAckCallback([this]() { return IRQAckPlaceholder(); });
+	SetRETICallback([this]() { RETIPlaceholder(); });
 #ifdef __Z80MEMCALLBACKS__
-	SetMemReadCallback(std::bind(&Z80::MemReadPlaceholder, this, std::placeholders::_1));
-	SetMemWriteCallback(std::bind(&Z80::MemWritePlaceholder, this, std::placeholders::_1, std::placeholders::_2));
+	SetMemReadCallback([this](ZWORD addr) { return MemReadPlaceholder(addr); });
+	SetMemWriteCallback([this](ZWORD addr, ZBYTE data) { MemWritePlaceholder(addr, data); });
 #endif
-
-#ifndef __Z80_BIG_ENDIAN__
-	CorrectEndianess();
+#ifdef __Z80BUSTIMING__
+	SetBusCallback([this](ZQWORD tstate, ZBYTE type, ZWORD addr, ZBYTE data) { BusPlaceholder(tstate, type, addr, data); });
 #endif
 }
 
@@ -94,62 +89,142 @@ Z80::Z80() {
 Z80::~Z80() {}
 
 
-void Z80::CorrectEndianess() {
+void Z80::NMI() {
+	events |= Z80EVENT_NMI;
+}
 
-	for (int i = 0; i < 7; i++) {
-		for (int j = 0; j < 256; j++) {
-		
-			if ((endianess_fix[j + (256*i)] & 0x01) == 1) {
-				if (a_set[i][j].operand1 & 0x01) {
-					a_set[i][j].operand1--;
-				} else {
-					a_set[i][j].operand1++;
-				}
-			}
 
-			if ((endianess_fix[j + (256*i)] & 0x02) == 2) {
-				if (a_set[i][j].operand2 & 0x01) {
-					a_set[i][j].operand2--;
-				} else {
-					a_set[i][j].operand2++;
-				}
-			}
 
-			if ((endianess_fix[j + (256*i)] & 0x04) == 4) {
-				if (a_set[i][j].operand3 & 0x01) {
-					a_set[i][j].operand3--;
-				} else {
-					a_set[i][j].operand3++;
-				}
+// Asserts INT. It stays asserted (level triggered) until ClearIRQ(), data is
+// the byte the device puts on the bus when the CPU acknowledges, address the
+// word that follows it when that byte is an IM 0 CALL or JP.
+
+void Z80::IRQ(ZBYTE data, ZWORD address) {
+	if (irqstats) {
+		if (irqstats->pending) {
+			if (!iff1) {
+				irqstats->missed++;
 			}
+		} else {
+			irqstats->requests++;
+			irqstats->pending = 1;
+			irqstats->pending_since = GetClock();
 		}
 	}
+
+	irq_data = data;
+	irq_vector = address;
+	events |= Z80EVENT_INT;
 }
 
 
-void Z80::NMI() {
-	nmi = 1;
+
+void Z80::ClearIRQ() {
+	if (irqstats && irqstats->pending) {
+		if (!iff1) {
+			irqstats->missed++;
+		}
+		irqstats->pending = 0;
+	}
+
+	events &= ~Z80EVENT_INT;
 }
 
 
-void Z80::IRQ0() {
-	im = 0;
+
+// Counters and histograms go to stats from now on, nullptr turns them off.
+// The struct is cleared.
+
+void Z80::SetIRQStats(Z80IRQSTATS *stats) {
+	if (stats) {
+		memset(stats, 0, sizeof(Z80IRQSTATS));
+	}
+	irqstats = stats;
 }
 
 
-void Z80::IRQ1() {
-	im = 1;
+// Z80Recorder::Start() / Stop() do this, nullptr turns recording off
+
+void Z80::SetRecorder(Z80Recorder *rec) {
+	recorder = rec;
 }
 
 
-void Z80::IRQ2(ZBYTE vector) {
-	im = 2;
-	irq_vector = vector;
+// WAIT held low for ts T-states. Charged before the next instruction (or
+// HALT NOP) starts.
+
+void Z80::Wait(unsigned int ts) {
+	if (ts) {
+		stall += ts;
+		events |= Z80EVENT_STALL;
+	}
+}
+
+
+
+// BUSREQ: the CPU floats the bus at the next instruction boundary and stays
+// off it for ts T-states while a DMA device uses it
+
+void Z80::BusRequest(unsigned int ts) {
+	if (ts) {
+		stall += ts;
+		events |= Z80EVENT_STALL;
+	}
 }
 
 
 unsigned int Z80::isHalted() {
-	return halted;
+	return (events & Z80EVENT_HALT) != 0;
+}
+
+
+
+// Halted with nothing that could wake it up, running it only burns NOPs
+
+bool Z80::isWaiting() {
+	if (isSuspended()) {
+		return true;
+	}
+	if ((events & (Z80EVENT_HALT | Z80EVENT_NMI | Z80EVENT_STALL)) != Z80EVENT_HALT) {
+		return false;
+	}
+	return !((events & Z80EVENT_INT) && iff1);
+}
+
+
+// Waiting for ResumeIO(), no time passes until then
+
+bool Z80::isSuspended() {
+	return (events & Z80EVENT_IOWAIT) && !io_ready;
+}
+
+
+
+// The value for the IN the CPU is suspended on. That instruction runs again
+// from its start on the next ExecuteXXX() call, so it takes exactly the
+// T-states it would have taken with a synchronous read. Call it from the
+// thread running the CPU.
+
+void Z80::ResumeIO(ZBYTE val) {
+	if (events & Z80EVENT_IOWAIT) {
+		io_value = val;
+		io_ready = true;
+	}
+}
+
+
+
+// Also exact from callbacks in the middle of an ExecuteTStates() or
+// ExecuteMCycle() call
+
+ZQWORD Z80::GetClock() {
+	return executing ? clock + tstates : clock;
+}
+
+
+
+ZQWORD Z80::GetIOCount() {
+	return io_count;
 }
 
 void Z80::SetIOReadCallback(std::function<ZBYTE(ZWORD)> cb) { 
@@ -158,17 +233,49 @@ void Z80::SetIOReadCallback(std::function<ZBYTE(ZWORD)> cb) {
 
 
 
+// Called when an IN is decoded, before any of it runs. Returning true with
+// the value carries on as usual. Returning false suspends the CPU at that
+// instruction boundary until ResumeIO(): ExecuteTStates() returns early and
+// the thread is free to run something else. Pass nullptr to turn it off.
+
+void Z80::SetIOReadAsyncCallback(std::function<bool(ZWORD, ZBYTE &)> cb) {
+	IOReadAsyncCallback = cb;
+	async_io = cb != nullptr;
+}
+
+
+
 void Z80::SetIOWriteCallback(std::function<void(ZWORD, ZBYTE)> cb) { 
 	IOWriteCallback = cb; 
 }
 
 
 
+void Z80::SetIRQAckCallback(std::function<ZBYTE()> cb) {
+	IRQAckCallback = cb;
+}
+
+
+
+// Called on every RETI, for daisy chained devices ending their service
+
+void Z80::SetRETICallback(std::function<void()> cb) {
+	RETICallback = cb;
+}
+
+
+
 unsigned int Z80::ExecuteInstruction() {
 
 	Run();
 	(this->*current_instruction)();
 
+	clock += tstates_counter;
+
+	if (shared) {
+		shared->Publish(this);
+	}
+
 	return mcycles_counter * 4; // Fix this
 
 }
@@ -178,6 +285,7 @@ unsigned int Z80::ExecuteInstruction() {
 unsigned int Z80::ExecuteTStates(unsigned int ts) {
 
 	tstates = 0;
+	executing = true;
 
 	// TODO: If 3 or lest tstates, it will execute the first mcycle of next instruction
 	while (tstates < ts) {
@@ -185,6 +293,10 @@ unsigned int Z80::ExecuteTStates(unsigned int ts) {
 		switch (tstates_counter) {
 			case 0:
 				Run();
+				if (tstates_counter == 0) {
+					// Suspended on an IN, the slice ends here
+					ts = tstates;
+				}
 				break;
 
 			case 1:
@@ -201,6 +313,13 @@ unsigned int Z80::ExecuteTStates(unsigned int ts) {
 		}
 	}
 
+	clock += tstates;
+	executing = false;
+
+	if (shared) {
+		shared->Publish(this);
+	}
+
 	return tstates;
 }
 
@@ -209,7 +328,9 @@ unsigned int Z80::ExecuteTStates(unsigned int ts) {
 unsigned int Z80::ExecuteMCycle() {
 
 	tstates = 0;
-		
+	executing = true;
+
+
 	switch (mcycles_counter) {
 		case 0:
 			Run();
@@ -228,80 +349,175 @@ unsigned int Z80::ExecuteMCycle() {
 			break;
 	}
 
+	clock += tstates;
+	executing = false;
+
+	if (shared) {
+		shared->Publish(this);
+	}
+
 	return tstates;
 }
 
 
 
+// Runs like ExecuteTStates(), queueing writes to the log's buffered ports
+// instead of calling IOWriteCallback. The log is cleared first.
+
+unsigned int Z80::ExecuteFrame(unsigned int ts, Z80IOLog *log) {
+
+	log->Clear();
+
+	iolog = log;
+	unsigned int executed = ExecuteTStates(ts);
+	iolog = nullptr;
+
+	return executed;
+}
+
+
+
 inline void Z80::Run() {
 		
 	// TODO: Handle stray DD and FD
 
+#ifdef __Z80BUSTIMING__
+	bus_start = GetClock();
+	bus_offset = 0;
+	bus_gaps = 0;
+#endif
+
+	if (events && Events()) {
+		return;
+	}
+
+	op = OPCODE(pc++);
+
+	reg.b.r++;
+
+	switch (op) {
+		case 0xCB:
+			i_set = 1;
+			CB_Exec();
+			break;
 			
-	if (!nmi && !irq) {
+		case 0xED:
+			i_set = 2;
+			ED_Exec();
+			break;
+			
+		case 0xDD:
+			i_set = 3;
+			DD_Exec();
+			break;
 			
-		defer_irq = 0;
+		case 0xFD:
+			i_set = 4;
+			FD_Exec();
+			break;
 
-		if (!halted) {
-			//mcycles_counter = 0;
-			//tstates_counter = 0;
+		case 0xDB:		// IN A, (n)
+			if (async_io && !AsyncIN((reg.b.a << 8) | PEEKBYTE(pc), pc - 1)) {
+				return;
+			}
+			// Falls through
 
-			op = READBYTE(pc++);
+		default:
+			i_set = 0;
+			current_instruction = main_instructions[op];
+			CHECKJUMP();
+			break;
+	}
+}
 
-			reg.b.r++;
 
-			switch (op) {
-				case 0xCB:
-					i_set = 1;
-					reg.b.r++;
-					op = READBYTE(pc++);
-
-					current_instruction = cb_instructions[op];
-					CHECKJUMP();
-					break;
-					
-				case 0xED:
-					i_set = 2;
-					ED_Exec();
-					break;
-					
-				case 0xDD:
-					i_set = 3;
-					DD_Exec();
-					break;
-					
-				case 0xFD:
-					i_set = 4;
-					FD_Exec();
-					break;
-
-				default:
-					i_set = 0;
-					current_instruction = main_instructions[op];
-					CHECKJUMP();
-					break;
-			}
 
-		} else {
-			// Execute NOPs while halted
-			last_mcycle_tstates = tstates_counter = 4;
-			mcycles_counter = 1;
+// Slow path of Run(), only while some event bit is set. Returns false when
+// the next instruction should be decoded as usual.
 
+bool Z80::Events() {
+
+	if (events & Z80EVENT_IOWAIT) {
+		if (!io_ready) {
+			// Still suspended
+			tstates_counter = mcycles_counter = 0;
 			current_instruction = main_instructions[0x00];
+			return true;
 		}
 
-	} else if (nmi) {
-		NonMaskableInterrupt();
-	} else if (irq && !defer_irq && iff1) {
-		MaskableInterrupt();
+		// Interrupts were checked before the IN was suspended, it goes
+		// first as it would have
+		events &= ~Z80EVENT_IOWAIT;
+		return false;
+	}
+
+	if (events & Z80EVENT_STALL) {
+		// Off the bus, NOP timed to the stall
+		events &= ~Z80EVENT_STALL;
+
+		if (recorder) {
+			recorder->Stall(GetClock(), stall);
+		}
+
+		mcycles_counter = (stall + 3) / 4;
+		last_mcycle_tstates = stall - (mcycles_counter - 1) * 4;
+		tstates_counter = stall;
+		stall = 0;
+
+		current_instruction = main_instructions[0x00];
+		return true;
+	}
+
+	if (events & Z80EVENT_NMI) {
+		AcceptNMI();
+		return true;
+	}
+
+	if ((events & (Z80EVENT_INT | Z80EVENT_EI)) == Z80EVENT_INT && iff1) {
+		AcceptIRQ();
+		return true;
 	}
+
+	events &= ~Z80EVENT_EI;
+
+	if (events & Z80EVENT_HALT) {
+		// Execute NOPs while halted
+#ifdef __Z80BUSTIMING__
+		OPCODE(pc);
+#endif
+		last_mcycle_tstates = tstates_counter = 4;
+		mcycles_counter = 1;
+
+		current_instruction = main_instructions[0x00];
+		return true;
+	}
+
+	return false;
+}
+
+
+
+void Z80::CB_Exec() {
+
+	reg.b.r++;
+	op = OPCODE(pc++);
+
+	current_instruction = cb_instructions[op];
+	CHECKJUMP();
 }
 
 
 
 void Z80::ED_Exec() {
 
-	op = READBYTE(pc++);
+	op = OPCODE(pc++);
+
+	// IN r, (C) and INI / IND / INIR / INDR, started 2 bytes back. Prefixes
+	// before the ED ran as NOPs of their own.
+	if (async_io && ((op & 0xc7) == 0x40 || (op & 0xe7) == 0xa2) &&
+		!AsyncIN(reg.w.bc, pc - 2)) {
+		return;
+	}
 
 	//if (op == 0xCB || op == 0xDD || op == 0xED || op == 0xFD) {
 
@@ -318,32 +534,37 @@ void Z80::ED_Exec() {
 
 void Z80::DD_Exec() {
 		
-	op = READBYTE(pc++);
+	op = OPCODE(pc++);
 	
 	switch (op) { // DDCB
 		case 0xCB:
 			i_set = 5;
 			reg.b.r++;
+#ifdef __Z80BUSTIMING__
+			// d goes on the bus before the opcode, the instruction peeks it again
+			(void) READBYTE(pc);
+#endif
 			op = READBYTE(pc++ + 1);
 			current_instruction = ddcb_instructions[op];
 			CHECKJUMP();
 			break;
 
 		case 0xED:	// if ED, DD is ignored
-			pc--;
-			tstates_counter += 4;
-			break;
-
 		case 0xDD:
-			pc--;
-			tstates_counter += 4;
-			break;
-
 		case 0xFD:
+			// Stray prefix, a NOP on its own
 			pc--;
-			tstates_counter += 4;
+			last_mcycle_tstates = tstates_counter = 4;
+			mcycles_counter = 1;
+			current_instruction = main_instructions[0x00];
 			break;
 
+		case 0xDB:	// IN A, (n), the prefix does nothing
+			if (async_io && !AsyncIN((reg.b.a << 8) | PEEKBYTE(pc), pc - 2)) {
+				return;
+			}
+			// Falls through
+
 		default:
 			reg.b.r++;
 			current_instruction = dd_instructions[op];
@@ -356,29 +577,36 @@ void Z80::DD_Exec() {
 
 void Z80::FD_Exec() {
 
-	op = READBYTE(pc++);
+	op = OPCODE(pc++);
 
 	switch (op) {
 		case 0xCB:  // FDCB
 			i_set = 6;
 			reg.b.r++;
+#ifdef __Z80BUSTIMING__
+			(void) READBYTE(pc);
+#endif
 			op = READBYTE(pc++ + 1);   // 3 and 4 operand are inverted in FDCB
 			current_instruction = fdcb_instructions[op];
 			CHECKJUMP();
 			break;
 
-		case 0xED:		// if ED, FD is ignored
-			ED_Exec();
-			break;
-
+		case 0xED:	// if ED, FD is ignored
 		case 0xDD:
-			DD_Exec();
-			break;
-
 		case 0xFD:
-			FD_Exec();
+			// Stray prefix, a NOP on its own
+			pc--;
+			last_mcycle_tstates = tstates_counter = 4;
+			mcycles_counter = 1;
+			current_instruction = main_instructions[0x00];
 			break;
 
+		case 0xDB:	// IN A, (n), the prefix does nothing
+			if (async_io && !AsyncIN((reg.b.a << 8) | PEEKBYTE(pc), pc - 2)) {
+				return;
+			}
+			// Falls through
+
 		default:
 			reg.b.r++;
 			current_instruction = fd_instructions[op];
@@ -389,63 +617,251 @@ void Z80::FD_Exec() {
 }
 
 
-void Z80::NonMaskableInterrupt() {
+// Slow path of the IN decode when async reads are on. Returns false after
+// rolling the decode back to start and suspending.
 
-	reg.b.r++;
-	halted = 0;
-	pc++;
+bool Z80::AsyncIN(ZWORD port, ZWORD start) {
+	if (io_ready) {
+		// Resumed, ReadIO() takes io_value
+		return true;
+	}
 
-	iff2 = iff1;
-	iff1 = 0;
-	/* Push */
-	reg.w.sp -= 2;
-	WRITEWORD(reg.w.sp, pc);
-	/* Push */
-	pc = 0x0066;
-	tstates += 5;
+	if (IOReadAsyncCallback(port, io_value)) {
+		io_ready = true;
+		return true;
+	}
+
+	pc = start;
+	reg.b.r--;
+	events |= Z80EVENT_IOWAIT;
+	tstates_counter = mcycles_counter = 0;
+	current_instruction = main_instructions[0x00];
+
+	return false;
 }
 
 
 
-void Z80::MaskableInterrupt() {
+// HALT leaves pc on itself, the return address is the next instruction
+
+void Z80::Wake() {
+	if (events & Z80EVENT_HALT) {
+		events &= ~Z80EVENT_HALT;
+		pc++;
+	}
+}
+
+
+
+// NMI acknowledge: 5 T-state M1 plus two writes. IFF2 keeps the old IFF1
+// for RETN.
+
+void Z80::AcceptNMI() {
+
+	events &= ~(Z80EVENT_NMI | Z80EVENT_EI);
+	Wake();
+
+	if (recorder) {
+		recorder->NMI(GetClock());
+	}
 
-	ZWORD vector_addr;
 	reg.b.r++;
-	halted = 0;
-	pc++;
+	iff1 = 0;
+
+#ifdef __Z80BUSTIMING__
+	// The opcode is fetched and ignored, the pushes come one T-state later
+	OPCODE(pc);
+	bus_gaps = 0x01;
+#endif
+
+	if (irqstats) {
+		irqstats->nmis++;
+		IRQEntry();
+	}
+
+	current_instruction = &Z80::NonMaskableInterrupt;
+	tstates_counter = 11;
+	mcycles_counter = 3;
+	last_mcycle_tstates = 3;
+}
+
+
+
+// INT acknowledge. The byte on the bus comes from IRQAckCallback, which is
+// where a daisy chain picks the device being served (defaults to the byte
+// given to IRQ()). IM 0 executes it as an opcode, 2 extra T-states for the
+// acknowledge: single byte ones (RST) and CALL nn / JP nn, whose address
+// bytes are 2 more IRQAckCallback calls, low one first. IM 1 takes 13
+// T-states, IM 2 19.
 
-	//int_req = 0;
+void Z80::AcceptIRQ() {
 
+	Wake();
+
+	reg.b.r++;
 	iff1 = iff2 = 0;
-		
-	switch (im) {
-		case 0:
 
-			// TODO: IM 0 is tricky
+	if (irqstats) {
+		irqstats->accepted++;
+		if (irqstats->pending) {
+			ZQWORD latency = GetClock() - irqstats->pending_since;
+			irqstats->latency_total += latency;
+			irqstats->latency_max = std::max(irqstats->latency_max, latency);
+			irqstats->latency[Bucket(latency)]++;
+			irqstats->pending = 0;
+		}
+		IRQEntry();
+	}
 
-		//	tstates += 6;
-			break;
+	ack_byte = 0;
+	irq_data = IRQAckCallback();
+
+	// The device keeps driving the bus for the operand of a CALL / JP, pc
+	// doesn't move
+	bool vector = im == 0 && (irq_data == 0xcd || irq_data == 0xc3);
+	if (vector) {
+		ZBYTE low = IRQAckCallback();
+		irq_vector = low | (IRQAckCallback() << 8);
+	}
+
+	if (recorder) {
+		if (vector) {
+			recorder->Interrupt(GetClock(), irq_data, irq_vector);
+		} else {
+			recorder->Interrupt(GetClock(), irq_data);
+		}
+	}
+
+#ifdef __Z80BUSTIMING__
+	// 6 T-state acknowledge, 2 of them automatic wait states. The pushes come
+	// one T-state later, IM 0 takes the timing of the opcode it executes.
+	BusCallback(bus_start, Z80BUS_INTACK, pc, irq_data);
+	bus_offset = 6;
+	bus_gaps = 0x01;
+#endif
+
+	switch (im) {
 		case 1:
-			/* Push */
-			reg.w.sp -= 2;
-			WRITEWORD(reg.w.sp, pc);
-			/* Push */
-			pc = 0x0038;
-		//	tstates += 7;
+			current_instruction = &Z80::MaskableInterrupt;
+			tstates_counter = 13;
+			mcycles_counter = 3;
+			last_mcycle_tstates = 5;
 			break;
+
 		case 2:
-			/* Push */
-			reg.w.sp -= 2;
-			WRITEWORD(reg.w.sp, pc);
-			/* Push */
-				
-			vector_addr = (reg.b.i << 8) | irq_vector;
-			pc = READWORD(vector_addr);
-			//tstates += 7;
+			current_instruction = &Z80::MaskableInterrupt;
+			tstates_counter = 19;
+			mcycles_counter = 5;
+			last_mcycle_tstates = 3;
+			break;
+
+		default:
+			i_set = 0;
+			op = irq_data;
+			current_instruction = main_instructions[op];
+			CHECKJUMP();
+			tstates_counter += 2;
+			if (vector) {
+				// 19 / 12 T-states, the body jumps to the vector read above
+				current_instruction = &Z80::MaskableInterrupt;
+#ifdef __Z80BUSTIMING__
+				BusCallback(bus_start + 6, Z80BUS_READ, pc, irq_vector & 0xff);
+				BusCallback(bus_start + 9, Z80BUS_READ, pc, irq_vector >> 8);
+				bus_offset = 12;
+				bus_gaps = 0x01;
+#endif
+			} else {
+				last_mcycle_tstates += 2;
+			}
+			break;
+	}
+}
+
+
+
+// A handler is running until a return pops the address pushed on entry.
+// Deeper than Z80IRQ_NESTING they're only counted, the returns of those
+// leave the tracked ones alone as SP stays below them.
+
+void Z80::IRQEntry() {
+	if (irqstats->depth == Z80IRQ_NESTING) {
+		irqstats->untracked++;
+		return;
+	}
+	irqstats->entry_clock[irqstats->depth] = GetClock();
+	irqstats->entry_sp[irqstats->depth] = reg.w.sp - 2;
+	irqstats->depth++;
+	irqstats->max_depth = std::max(irqstats->max_depth, irqstats->depth);
+}
+
+
+
+// Called by the return instructions when stats are on. RET counts too, lots
+// of IM 1 handlers end with EI; RET.
+
+void Z80::IRQReturn() {
+	while (irqstats->depth > 0) {
+		unsigned int top = irqstats->depth - 1;
+
+		// Popped once SP is past the return address, the stack may wrap
+		// around 64 KB
+		if ((ZWORD) (reg.w.sp - irqstats->entry_sp[top] - 1) >= 0x8000) {
 			break;
+		}
+
+		ZQWORD service = GetClock() - irqstats->entry_clock[top];
+		irqstats->services++;
+		irqstats->service_total += service;
+		irqstats->service_max = std::max(irqstats->service_max, service);
+		irqstats->service[Bucket(service)]++;
+		irqstats->depth--;
+	}
+}
+
+
+
+int Z80::Bucket(ZQWORD ts) {
+	int bucket = 0;
+	while (ts > 0 && bucket < Z80IRQ_BUCKETS - 1) {
+		ts >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+
+
+void Z80::NonMaskableInterrupt() {
+	/* Push */
+	reg.w.sp -= 2;
+	PUSHWORD(reg.w.sp, pc);
+	/* Push */
+	pc = 0x0066;
+	reg.w.wz = pc;
+}
+
+
+
+void Z80::MaskableInterrupt() {
+	if (im == 0 && op == 0xc3) {
+		pc = irq_vector;
+		reg.w.wz = pc;
+		return;
 	}
 
-	tstates += 7; // ACK interrupt
+	/* Push */
+	reg.w.sp -= 2;
+	PUSHWORD(reg.w.sp, pc);
+	/* Push */
+
+	if (im == 2) {
+		pc = READWORD((reg.b.i << 8) | irq_data);
+	} else if (im == 1) {
+		pc = 0x0038;
+	} else {
+		pc = irq_vector;
+	}
+	reg.w.wz = pc;
 }
 
 
@@ -457,7 +873,9 @@ void Z80::Reset() {
 	reg.w.sp = 0xffff;
 	reg.w.af = 0xffff;
 
-	halted = 0;
+	events &= Z80EVENT_INT;		// The INT line is external
+	io_ready = false;
+	stall = 0;
 
 	tstates_counter = 0;
 	mcycles_counter = 0;
@@ -465,7 +883,178 @@ void Z80::Reset() {
 }
 
 
-#ifdef __Z80MEMCALLBACKS__
+// Can be called between any two ExecuteXXX() calls, also with an
+// instruction half way through: it resumes at the same T-state after
+// LoadState(). Callbacks and instrumentation aren't part of the state. The
+// address space is skipped by both when memory is null or with_memory is
+// false, for callers keeping track of memory themselves.
+
+void Z80::SaveState(Z80STATE *state, bool with_memory) {
+	state->magic = Z80STATE_MAGIC;
+	state->version = Z80STATE_VERSION;
+	state->size = sizeof(Z80STATE);
+	state->events = events;
+
+	state->af = reg.w.af;
+	state->bc = reg.w.bc;
+	state->de = reg.w.de;
+	state->hl = reg.w.hl;
+	state->alt_af = alt_reg.w.af;
+	state->alt_bc = alt_reg.w.bc;
+	state->alt_de = alt_reg.w.de;
+	state->alt_hl = alt_reg.w.hl;
+	state->ix = reg.w.ix;
+	state->iy = reg.w.iy;
+	state->sp = reg.w.sp;
+	state->pc = pc;
+	state->ir = reg.w.ir;
+	state->wz = reg.w.wz;
+	state->iff1 = iff1;
+	state->iff2 = iff2;
+	state->im = im;
+	state->op = op;
+	state->i_set = i_set;
+	state->io_ready = io_ready;
+	state->io_value = io_value;
+	state->irq_data = irq_data;
+
+	// Usually the table i_set says, a stray DD / FD prefix runs a NOP from another one
+	state->instruction = 0;
+	if (instruction_tables[i_set][op] == current_instruction) {
+		state->instruction = (i_set << 8) | op;
+	} else {
+		for (int i = 0; i < 7 * 256; i++) {
+			if (instruction_tables[i >> 8][i & 0xff] == current_instruction) {
+				state->instruction = i;
+				break;
+			}
+		}
+	}
+	state->irq_vector = irq_vector;
+
+	state->tstates_counter = tstates_counter;
+	state->mcycles_counter = mcycles_counter;
+	state->last_mcycle_tstates = last_mcycle_tstates;
+	state->will_jump = will_jump;
+	state->stall = stall;
+	state->ioreq = ioreq;
+
+	state->clock = GetClock();
+	state->io_count = io_count;
+#ifdef __Z80BUSTIMING__
+	state->bus_start = bus_start;
+	state->bus_offset = bus_offset;
+	state->bus_gaps = bus_gaps;
+#else
+	state->bus_start = 0;
+	state->bus_offset = 0;
+	state->bus_gaps = 0;
+#endif
+
+	if (memory && with_memory) {
+		memcpy(state->memory, memory, sizeof(Z80ADDRESSBUS));
+	}
+}
+
+
+
+// Returns 1, leaving the CPU untouched, if the state comes from another
+// version or build of the layout
+
+int Z80::LoadState(const Z80STATE *state, bool with_memory) {
+	if (state->magic != Z80STATE_MAGIC || state->version != Z80STATE_VERSION ||
+		state->size != sizeof(Z80STATE) || state->i_set > 6 || state->instruction >= 7 * 256) {
+		return 1;
+	}
+
+	events = state->events;
+
+	reg.w.af = state->af;
+	reg.w.bc = state->bc;
+	reg.w.de = state->de;
+	reg.w.hl = state->hl;
+	alt_reg.w.af = state->alt_af;
+	alt_reg.w.bc = state->alt_bc;
+	alt_reg.w.de = state->alt_de;
+	alt_reg.w.hl = state->alt_hl;
+	reg.w.ix = state->ix;
+	reg.w.iy = state->iy;
+	reg.w.sp = state->sp;
+	pc = state->pc;
+	reg.w.ir = state->ir;
+	reg.w.wz = state->wz;
+	iff1 = state->iff1;
+	iff2 = state->iff2;
+	im = state->im;
+	op = state->op;
+	i_set = state->i_set;
+	io_ready = state->io_ready;
+	io_value = state->io_value;
+	irq_data = state->irq_data;
+	irq_vector = state->irq_vector;
+	current_instruction = instruction_tables[state->instruction >> 8][state->instruction & 0xff];
+
+	tstates_counter = state->tstates_counter;
+	mcycles_counter = state->mcycles_counter;
+	last_mcycle_tstates = state->last_mcycle_tstates;
+	will_jump = state->will_jump;
+	stall = state->stall;
+	ioreq = state->ioreq;
+
+	clock = state->clock;
+	io_count = state->io_count;
+#ifdef __Z80BUSTIMING__
+	bus_start = state->bus_start;
+	bus_offset = state->bus_offset;
+	bus_gaps = state->bus_gaps;
+#endif
+
+	if (memory && with_memory) {
+		memcpy(memory, state->memory, sizeof(Z80ADDRESSBUS));
+		dirty[0] = dirty[1] = dirty[2] = dirty[3] = ~0ULL;
+	}
+
+	return 0;
+}
+
+
+
+// ORs the 256 byte pages the CPU wrote since the last call (and all of them
+// after a LoadState()) into pages, page n is bit n % 64 of pages[n / 64],
+// and starts over. Writes the host does straight to memory aren't seen.
+// With a Z80SharedState attached a page may be reported twice.
+
+void Z80::TakeDirtyPages(ZQWORD pages[4]) {
+	for (int i = 0; i < 4; i++) {
+		pages[i] |= dirty[i] | published[i];
+		published[i] = 0;
+
+		// An attached Z80SharedState clears them when it publishes them
+		if (!shared) {
+			dirty[i] = 0;
+		}
+	}
+}
+
+
+
+// For the host (DMA, loaders, debuggers) writing straight to memory, so
+// TakeDirtyPages() and an attached Z80SharedState see it. Wraps at 64 KB.
+
+void Z80::MarkDirty(ZWORD addr, unsigned int len) {
+	if (len == 0) {
+		return;
+	}
+
+	unsigned int pages = std::min(((addr & 0xff) + len + 0xff) >> 8, 256u);
+	for (unsigned int i = 0; i < pages; i++) {
+		MARKDIRTY(addr + (i << 8));
+	}
+}
+
+
+
+#if defined(__Z80MEMCALLBACKS__) || defined(__Z80BUSTIMING__)
 ZWORD Z80::ReadWord(ZWORD addr) {
 	ZBYTE lsb = READBYTE(addr);
 	ZBYTE msb = READBYTE(addr + 1);
@@ -480,15 +1069,90 @@ void Z80::WriteWord(ZWORD addr, ZWORD val) {
 #endif
 
 
+#ifdef __Z80BUSTIMING__
+
+// Every access is reported at its T-state within the instruction: 4 T-states
+// per opcode fetch and I/O cycle, 3 per memory read or write, plus the
+// internal T-states bus_gap_table puts before the accesses of the body.
+
+#define BUSGAP() \
+{ \
+	bus_offset += bus_gaps & 0x0f; \
+	bus_gaps >>= 4; \
+}
+
+ZBYTE Z80::BusFetch(ZWORD addr) {
+	ZBYTE val = MEMREAD(addr);
+	BusCallback(bus_start + bus_offset, Z80BUS_FETCH, addr, val);
+	bus_offset += 4;
+	return val;
+}
+
+
+ZBYTE Z80::BusRead(ZWORD addr) {
+	BUSGAP();
+	ZBYTE val = MEMREAD(addr);
+	BusCallback(bus_start + bus_offset, Z80BUS_READ, addr, val);
+	bus_offset += 3;
+	return val;
+}
+
+
+void Z80::BusWrite(ZWORD addr, ZBYTE val) {
+	BUSGAP();
+	MEMWRITE(addr, val);
+	BusCallback(bus_start + bus_offset, Z80BUS_WRITE, addr, val);
+	bus_offset += 3;
+}
+
+
+void Z80::SetBusCallback(std::function<void(ZQWORD, ZBYTE, ZWORD, ZBYTE)> cb) {
+	BusCallback = cb;
+}
+
+
+void Z80::BusPlaceholder(ZQWORD, ZBYTE, ZWORD, ZBYTE) {}
+
+#endif
+
+
 ZBYTE Z80::ReadIO(ZWORD addr) {
 	ioreq = 1;
-	IOReadCallback(addr);
-	return addr >> 8;
+	io_count++;
+	ZBYTE val;
+	if (io_ready) {
+		val = io_value;
+		io_ready = false;
+	} else {
+		val = IOReadCallback(addr);
+	}
+	if (recorder) {
+		recorder->In(GetClock(), addr, val);
+	}
+#ifdef __Z80BUSTIMING__
+	BUSGAP();
+	BusCallback(bus_start + bus_offset, Z80BUS_IOREAD, addr, val);
+	bus_offset += 4;
+#endif
+	return val;
 }
 
 
 void Z80::WriteIO(ZWORD addr, ZBYTE val) {
 	ioreq = 2;
+	io_count++;
+#ifdef __Z80BUSTIMING__
+	BUSGAP();
+	ZQWORD now = bus_start + bus_offset;
+	BusCallback(now, Z80BUS_IOWRITE, addr, val);
+	bus_offset += 4;
+#else
+	ZQWORD now = GetClock();
+#endif
+	if (iolog && iolog->IsBuffered(addr)) {
+		iolog->Push(now, addr, val);
+		return;
+	}
 	IOWriteCallback(addr, val);
 }
 
@@ -506,6 +1170,25 @@ void Z80::IOWritePlaceholder(ZWORD addr, ZBYTE data) {
 }
 
 
+
+// The byte given to IRQ(), then the address for an IM 0 CALL / JP
+
+ZBYTE Z80::IRQAckPlaceholder() {
+	switch (ack_byte++) {
+		case 0:
+			return irq_data;
+		case 1:
+			return irq_vector & 0xff;
+		default:
+			return irq_vector >> 8;
+	}
+}
+
+
+
+void Z80::RETIPlaceholder() {}
+
+
 #ifdef __Z80MEMCALLBACKS__
 	
 void Z80::SetMemReadCallback(std::function<ZBYTE(ZWORD)> cb) { 
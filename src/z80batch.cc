@@ -0,0 +1,566 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+
+#include "z80batch.h"
+
+
+#define FLAG_S		(1 << 7)
+#define FLAG_Z		(1 << 6)
+#define FLAG_Y		(1 << 5)
+#define FLAG_H		(1 << 4)
+#define FLAG_X		(1 << 3)
+#define FLAG_PV		(1 << 2)
+#define FLAG_N		(1 << 1)
+#define FLAG_C		(1 << 0)
+
+#define ALU_ADD		0
+#define ALU_ADC		1
+#define ALU_SUB		2
+#define ALU_SBC		3
+#define ALU_AND		4
+#define ALU_XOR		5
+#define ALU_OR		6
+#define ALU_CP		7
+
+#define LANE(k)		(DENSE ? (k) : idx[k])
+#define BASE(n)		((size_t) (n) << 16)
+
+
+static const ZBYTE V[4] = { 0, FLAG_PV, FLAG_PV, 0 };
+
+
+
+Z80Batch::Z80Batch(unsigned int lanes) : lanes(lanes), memory(BASE(lanes)),
+	a(lanes), f(lanes), b(lanes), c(lanes), d(lanes), e(lanes), h(lanes), l(lanes), i(lanes), r(lanes),
+	ix(lanes), iy(lanes), sp(lanes), wz(lanes), pc(lanes),
+	af_(lanes), bc_(lanes), de_(lanes), hl_(lanes),
+	iff1(lanes), iff2(lanes), im(lanes), events(lanes), clock(lanes),
+	stall(lanes), irq_data(lanes), irq_vector(lanes),
+	order(lanes), keys(lanes) {
+
+	// Same values as the core's SZ_table and SZP_table
+	for (int v = 0; v < 256; v++) {
+		int parity = 1;
+		for (int bit = 0; bit < 8; bit++) {
+			parity ^= (v >> bit) & 1;
+		}
+		SZ[v] = (v & (FLAG_S | FLAG_Y | FLAG_X)) | (v == 0 ? FLAG_Z : 0);
+		SZP[v] = SZ[v] | (parity ? FLAG_PV : 0);
+	}
+
+	// Registers start as after Reset()
+	for (unsigned int n = 0; n < lanes; n++) {
+		a[n] = f[n] = 0xff;
+		sp[n] = 0xffff;
+	}
+
+#ifdef __Z80MEMCALLBACKS__
+	ref.SetMemReadCallback([this](ZWORD addr) { return ref.memory[addr]; });
+	ref.SetMemWriteCallback([this](ZWORD addr, ZBYTE val) { ref.memory[addr] = val; });
+#endif
+	ref.SetIOReadCallback([this](ZWORD addr) {
+		return IOReadCallback ? IOReadCallback(ref_lane, addr) : (ZBYTE) 0xff;
+	});
+	ref.SetIOWriteCallback([this](ZWORD addr, ZBYTE val) {
+		if (IOWriteCallback) {
+			IOWriteCallback(ref_lane, addr, val);
+		}
+	});
+}
+
+
+
+unsigned int Z80Batch::GetLanes() {
+	return lanes;
+}
+
+
+
+ZBYTE *Z80Batch::GetMemory(unsigned int lane) {
+	return &memory[BASE(lane)];
+}
+
+
+
+// Copies the registers (not the memory) of a scalar core into a lane
+
+void Z80Batch::Load(unsigned int lane, Z80 *cpu) {
+	a[lane] = cpu->reg.b.a;
+	f[lane] = cpu->reg.b.f;
+	b[lane] = cpu->reg.b.b;
+	c[lane] = cpu->reg.b.c;
+	d[lane] = cpu->reg.b.d;
+	e[lane] = cpu->reg.b.e;
+	h[lane] = cpu->reg.b.h;
+	l[lane] = cpu->reg.b.l;
+	i[lane] = cpu->reg.b.i;
+	r[lane] = cpu->reg.b.r;
+	ix[lane] = cpu->reg.w.ix;
+	iy[lane] = cpu->reg.w.iy;
+	sp[lane] = cpu->reg.w.sp;
+	wz[lane] = cpu->reg.w.wz;
+	pc[lane] = cpu->pc;
+	af_[lane] = cpu->alt_reg.w.af;
+	bc_[lane] = cpu->alt_reg.w.bc;
+	de_[lane] = cpu->alt_reg.w.de;
+	hl_[lane] = cpu->alt_reg.w.hl;
+	iff1[lane] = cpu->iff1;
+	iff2[lane] = cpu->iff2;
+	im[lane] = cpu->im;
+	events[lane] = cpu->events;
+	stall[lane] = cpu->stall;
+	irq_data[lane] = cpu->irq_data;
+	irq_vector[lane] = cpu->irq_vector;
+	clock[lane] = cpu->clock;
+}
+
+
+
+void Z80Batch::Store(unsigned int lane, Z80 *cpu) {
+	cpu->reg.b.a = a[lane];
+	cpu->reg.b.f = f[lane];
+	cpu->reg.b.b = b[lane];
+	cpu->reg.b.c = c[lane];
+	cpu->reg.b.d = d[lane];
+	cpu->reg.b.e = e[lane];
+	cpu->reg.b.h = h[lane];
+	cpu->reg.b.l = l[lane];
+	cpu->reg.b.i = i[lane];
+	cpu->reg.b.r = r[lane];
+	cpu->reg.w.ix = ix[lane];
+	cpu->reg.w.iy = iy[lane];
+	cpu->reg.w.sp = sp[lane];
+	cpu->reg.w.wz = wz[lane];
+	cpu->pc = pc[lane];
+	cpu->alt_reg.w.af = af_[lane];
+	cpu->alt_reg.w.bc = bc_[lane];
+	cpu->alt_reg.w.de = de_[lane];
+	cpu->alt_reg.w.hl = hl_[lane];
+	cpu->iff1 = iff1[lane];
+	cpu->iff2 = iff2[lane];
+	cpu->im = im[lane];
+	cpu->events = events[lane];
+	cpu->stall = stall[lane];
+	cpu->irq_data = irq_data[lane];
+	cpu->irq_vector = irq_vector[lane];
+	cpu->clock = clock[lane];
+}
+
+
+
+void Z80Batch::SetIOReadCallback(std::function<ZBYTE(unsigned int, ZWORD)> cb) {
+	IOReadCallback = cb;
+}
+
+
+
+void Z80Batch::SetIOWriteCallback(std::function<void(unsigned int, ZWORD, ZBYTE)> cb) {
+	IOWriteCallback = cb;
+}
+
+
+
+ZQWORD Z80Batch::GetClock(unsigned int lane) {
+	return clock[lane];
+}
+
+
+
+ZQWORD Z80Batch::GetVectorized() {
+	return vectorized;
+}
+
+
+
+ZQWORD Z80Batch::GetScalar() {
+	return scalar;
+}
+
+
+
+void Z80Batch::Run(unsigned int steps) {
+	for (unsigned int s = 0; s < steps; s++) {
+		Step();
+	}
+}
+
+
+
+void Z80Batch::Step() {
+	unsigned int start[258];
+
+	memset(start, 0, sizeof(start));
+
+	// Counting sort of the lanes by next opcode, key 256 is "needs the
+	// scalar core". Stable, so a group holding every lane is 0 .. lanes - 1.
+	for (unsigned int n = 0; n < lanes; n++) {
+		unsigned int key = events[n] ? 256 : memory[BASE(n) + pc[n]];
+		keys[n] = key;
+		start[key + 1]++;
+	}
+	for (unsigned int key = 1; key < 258; key++) {
+		start[key] += start[key - 1];
+	}
+
+	unsigned int fill[257];
+	memcpy(fill, start, sizeof(fill));
+	for (unsigned int n = 0; n < lanes; n++) {
+		order[fill[keys[n]]++] = n;
+	}
+
+	for (unsigned int key = 0; key < 257; key++) {
+		unsigned int count = start[key + 1] - start[key];
+		if (count == 0) {
+			continue;
+		}
+
+		const unsigned int *idx = &order[start[key]];
+		bool done = false;
+
+		if (key < 256) {
+			done = count == lanes ? Execute<true>(key, idx, count) : Execute<false>(key, idx, count);
+		}
+
+		if (done) {
+			vectorized += count;
+		} else {
+			for (unsigned int k = 0; k < count; k++) {
+				Scalar(idx[k]);
+			}
+			scalar += count;
+		}
+	}
+}
+
+
+
+// One instruction of one lane on the reference core
+
+void Z80Batch::Scalar(unsigned int lane) {
+	ref_lane = lane;
+	ref.memory = GetMemory(lane);
+	Store(lane, &ref);
+	ref.ExecuteInstruction();
+	Load(lane, &ref);
+}
+
+
+
+// Returns false for the instructions left to the scalar core. Timings, R,
+// WZ and flags (undocumented bits included) follow the core.
+
+template <bool DENSE>
+bool Z80Batch::Execute(ZBYTE op, const unsigned int *idx, unsigned int n) {
+
+	ZBYTE *mem = memory.data();
+	ZBYTE *R8[8] = { b.data(), c.data(), d.data(), e.data(), h.data(), l.data(), nullptr, a.data() };
+	unsigned int x = op >> 6;
+	unsigned int y = (op >> 3) & 7;
+	unsigned int z = op & 7;
+	unsigned int len = 1;
+	unsigned int ts = 4;
+
+	if (op == 0x00) {
+		// NOP
+
+	} else if (x == 1 && op != 0x76) {
+
+		if (y != 6 && z != 6) {
+			// LD r, r'
+			ZBYTE *dst = R8[y];
+			ZBYTE *src = R8[z];
+			for (unsigned int k = 0; k < n; k++) {
+				unsigned int m = LANE(k);
+				dst[m] = src[m];
+			}
+		} else if (z == 6) {
+			// LD r, (HL)
+			ZBYTE *dst = R8[y];
+			for (unsigned int k = 0; k < n; k++) {
+				unsigned int m = LANE(k);
+				dst[m] = mem[BASE(m) + ((h[m] << 8) | l[m])];
+			}
+			ts = 7;
+		} else {
+			// LD (HL), r
+			ZBYTE *src = R8[z];
+			for (unsigned int k = 0; k < n; k++) {
+				unsigned int m = LANE(k);
+				mem[BASE(m) + ((h[m] << 8) | l[m])] = src[m];
+			}
+			ts = 7;
+		}
+
+	} else if (x == 0 && z == 6 && y != 6) {
+		// LD r, n
+		ZBYTE *dst = R8[y];
+		for (unsigned int k = 0; k < n; k++) {
+			unsigned int m = LANE(k);
+			dst[m] = mem[BASE(m) + (ZWORD) (pc[m] + 1)];
+		}
+		len = 2;
+		ts = 7;
+
+	} else if (x == 0 && (z == 4 || z == 5) && y != 6) {
+		// INC r / DEC r
+		ZBYTE *reg = R8[y];
+		if (z == 4) {
+			for (unsigned int k = 0; k < n; k++) {
+				unsigned int m = LANE(k);
+				ZWORD halfcarry = reg[m] ^ (reg[m] + 1);
+				reg[m]++;
+				f[m] = (f[m] & FLAG_C) | (halfcarry & FLAG_H) | SZ[reg[m]] | V[(halfcarry >> 7) & 0x03];
+			}
+		} else {
+			for (unsigned int k = 0; k < n; k++) {
+				unsigned int m = LANE(k);
+				ZWORD halfcarry = reg[m] ^ (reg[m] - 1);
+				reg[m]--;
+				f[m] = (f[m] & FLAG_C) | FLAG_N | (halfcarry & FLAG_H) | SZ[reg[m]] | V[(halfcarry >> 7) & 0x03];
+			}
+		}
+
+	} else if (x == 2 && z != 6) {
+		// ALU A, r
+		Alu<DENSE>(y, R8[z], false, idx, n);
+
+	} else if (x == 3 && z == 6) {
+		// ALU A, n
+		Alu<DENSE>(y, nullptr, true, idx, n);
+		len = 2;
+		ts = 7;
+
+	} else if (x == 0 && z == 3) {
+		// INC rr / DEC rr
+		unsigned int p = y >> 1;
+		ZWORD delta = (y & 1) ? 0xffff : 1;
+		for (unsigned int k = 0; k < n; k++) {
+			unsigned int m = LANE(k);
+			switch (p) {
+				case 0: { ZWORD w = ((b[m] << 8) | c[m]) + delta; b[m] = w >> 8; c[m] = w; break; }
+				case 1: { ZWORD w = ((d[m] << 8) | e[m]) + delta; d[m] = w >> 8; e[m] = w; break; }
+				case 2: { ZWORD w = ((h[m] << 8) | l[m]) + delta; h[m] = w >> 8; l[m] = w; break; }
+				default: sp[m] += delta; break;
+			}
+		}
+		ts = 6;
+
+	} else if (x == 0 && z == 1 && (y & 1) == 0) {
+		// LD rr, nn
+		unsigned int p = y >> 1;
+		for (unsigned int k = 0; k < n; k++) {
+			unsigned int m = LANE(k);
+			ZBYTE lo = mem[BASE(m) + (ZWORD) (pc[m] + 1)];
+			ZBYTE hi = mem[BASE(m) + (ZWORD) (pc[m] + 2)];
+			switch (p) {
+				case 0: b[m] = hi; c[m] = lo; break;
+				case 1: d[m] = hi; e[m] = lo; break;
+				case 2: h[m] = hi; l[m] = lo; break;
+				default: sp[m] = (hi << 8) | lo; break;
+			}
+		}
+		len = 3;
+		ts = 10;
+
+	} else if (op == 0xc3) {
+		// JP nn
+		for (unsigned int k = 0; k < n; k++) {
+			unsigned int m = LANE(k);
+			ZWORD addr = mem[BASE(m) + (ZWORD) (pc[m] + 1)] | (mem[BASE(m) + (ZWORD) (pc[m] + 2)] << 8);
+			pc[m] = addr;
+			wz[m] = addr;
+			r[m]++;
+			clock[m] += 10;
+		}
+		return true;
+
+	} else if (op == 0x18 || op == 0x10 || (op & 0xe7) == 0x20) {
+		// JR e, JR cc, e and DJNZ e, time depends on the lane
+		for (unsigned int k = 0; k < n; k++) {
+			unsigned int m = LANE(k);
+			signed char offset = (signed char) mem[BASE(m) + (ZWORD) (pc[m] + 1)];
+			bool jump;
+
+			if (op == 0x18) {
+				jump = true;
+			} else if (op == 0x10) {
+				b[m]--;
+				jump = b[m] != 0;
+			} else {
+				ZBYTE flag = (y & 2) ? FLAG_C : FLAG_Z;
+				jump = ((f[m] & flag) != 0) == ((y & 1) != 0);
+			}
+
+			pc[m] += 2;
+			if (jump) {
+				pc[m] += offset;
+				wz[m] = pc[m];
+			}
+			r[m]++;
+			clock[m] += (op == 0x10 ? 8 : 7) + (jump ? 5 : 0);
+		}
+		return true;
+
+	} else {
+		return false;
+	}
+
+	for (unsigned int k = 0; k < n; k++) {
+		unsigned int m = LANE(k);
+		pc[m] += len;
+		r[m]++;
+		clock[m] += ts;
+	}
+
+	return true;
+}
+
+
+
+template <bool DENSE>
+void Z80Batch::Alu(unsigned int kind, const ZBYTE *src, bool immediate, const unsigned int *idx, unsigned int n) {
+
+	ZBYTE *mem = memory.data();
+
+	for (unsigned int k = 0; k < n; k++) {
+		unsigned int m = LANE(k);
+		ZBYTE value = immediate ? mem[BASE(m) + (ZWORD) (pc[m] + 1)] : src[m];
+		ZWORD result, halfcarry;
+
+		switch (kind) {
+			case ALU_ADD:
+			case ALU_ADC:
+				result = a[m] + value + (kind == ALU_ADC ? (f[m] & FLAG_C) : 0);
+				halfcarry = a[m] ^ value ^ result;
+				f[m] = (halfcarry & FLAG_H) | SZ[result & 0xff] | V[halfcarry >> 7] | (result >> 8);
+				f[m] = (f[m] & ~(FLAG_Y | FLAG_X)) | (result & (FLAG_Y | FLAG_X));
+				a[m] = result;
+				break;
+
+			case ALU_SUB:
+			case ALU_SBC:
+			case ALU_CP:
+				result = a[m] - value - (kind == ALU_SBC ? (f[m] & FLAG_C) : 0);
+				halfcarry = a[m] ^ value ^ result;
+				f[m] = FLAG_N | (halfcarry & FLAG_H);
+				if (kind == ALU_CP) {
+					f[m] |= SZ[result & 0xff] & (FLAG_S | FLAG_Z);
+				} else {
+					f[m] |= SZ[result & 0xff];
+				}
+				halfcarry &= 0x0180;
+				f[m] |= V[halfcarry >> 7] | (halfcarry >> 8);
+				if (kind == ALU_CP) {
+					f[m] = (f[m] & ~(FLAG_Y | FLAG_X)) | (value & (FLAG_Y | FLAG_X));
+				} else {
+					f[m] = (f[m] & ~(FLAG_Y | FLAG_X)) | (result & (FLAG_Y | FLAG_X));
+					a[m] = result;
+				}
+				break;
+
+			case ALU_AND:
+				a[m] &= value;
+				f[m] = SZP[a[m]] | FLAG_H;
+				break;
+
+			case ALU_XOR:
+				a[m] ^= value;
+				f[m] = SZP[a[m]];
+				break;
+
+			default:
+				a[m] |= value;
+				f[m] = SZP[a[m]];
+				break;
+		}
+	}
+}
+
+
+
+bool Z80Batch::Same(unsigned int lane, Z80 *cpu) {
+	Z80 mine;
+	Store(lane, &mine);
+
+	return mine.reg.w.af == cpu->reg.w.af && mine.reg.w.bc == cpu->reg.w.bc &&
+		mine.reg.w.de == cpu->reg.w.de && mine.reg.w.hl == cpu->reg.w.hl &&
+		mine.reg.w.ix == cpu->reg.w.ix && mine.reg.w.iy == cpu->reg.w.iy &&
+		mine.reg.w.sp == cpu->reg.w.sp && mine.reg.w.ir == cpu->reg.w.ir &&
+		mine.reg.w.wz == cpu->reg.w.wz && mine.pc == cpu->pc &&
+		mine.alt_reg.w.af == cpu->alt_reg.w.af && mine.alt_reg.w.bc == cpu->alt_reg.w.bc &&
+		mine.alt_reg.w.de == cpu->alt_reg.w.de && mine.alt_reg.w.hl == cpu->alt_reg.w.hl &&
+		mine.iff1 == cpu->iff1 && mine.iff2 == cpu->iff2 && mine.im == cpu->im &&
+		mine.events == cpu->events && mine.stall == cpu->stall &&
+		mine.irq_data == cpu->irq_data && mine.irq_vector == cpu->irq_vector && mine.clock == cpu->clock;
+}
+
+
+
+// Runs steps instructions here and, lane by lane, on a scalar core started
+// from the same state. Returns the first lane that ends up different
+// (registers, clock or memory), -1 if they all match. Leaves the batch
+// stepped.
+
+int Z80Batch::SelfTest(unsigned int steps) {
+	std::vector<ZBYTE> initial(memory);
+	std::vector<Z80 *> cores(lanes);
+
+	for (unsigned int n = 0; n < lanes; n++) {
+		cores[n] = new Z80;
+		Store(n, cores[n]);
+	}
+
+	Run(steps);
+
+	int failed = -1;
+
+	for (unsigned int n = 0; n < lanes && failed < 0; n++) {
+		Z80 *cpu = cores[n];
+		ZBYTE *lane_memory = &initial[BASE(n)];
+
+		cpu->memory = lane_memory;
+#ifdef __Z80MEMCALLBACKS__
+		cpu->SetMemReadCallback([lane_memory](ZWORD addr) { return lane_memory[addr]; });
+		cpu->SetMemWriteCallback([lane_memory](ZWORD addr, ZBYTE val) { lane_memory[addr] = val; });
+#endif
+		cpu->SetIOReadCallback([this, n](ZWORD addr) {
+			return IOReadCallback ? IOReadCallback(n, addr) : (ZBYTE) 0xff;
+		});
+		cpu->SetIOWriteCallback([this, n](ZWORD addr, ZBYTE val) {
+			if (IOWriteCallback) {
+				IOWriteCallback(n, addr, val);
+			}
+		});
+
+		for (unsigned int s = 0; s < steps; s++) {
+			cpu->ExecuteInstruction();
+		}
+
+		if (!Same(n, cpu) || memcmp(lane_memory, GetMemory(n), 0x10000) != 0) {
+			failed = n;
+		}
+	}
+
+	for (auto cpu : cores) {
+		delete cpu;
+	}
+
+	return failed;
+}
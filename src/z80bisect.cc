@@ -0,0 +1,229 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "z80bisect.h"
+
+
+#define FLAG_S		(1 << 7)
+#define FLAG_Z		(1 << 6)
+#define FLAG_Y		(1 << 5)
+#define FLAG_H		(1 << 4)
+#define FLAG_X		(1 << 3)
+#define FLAG_PV		(1 << 2)
+#define FLAG_N		(1 << 1)
+#define FLAG_C		(1 << 0)
+
+
+Z80Bisect::Z80Bisect(const Z80ENGINE *a, const Z80ENGINE *b) : a(a), b(b) {
+	good = new Z80STATE();
+	state_a = new Z80STATE();
+	state_b = new Z80STATE();
+}
+
+
+
+Z80Bisect::~Z80Bisect() {
+	delete good;
+	delete state_a;
+	delete state_b;
+}
+
+
+
+// Returns the number of the first instruction after which the engines
+// differ (0 if they already do once loaded), -1 if they agree for steps
+// instructions
+
+long long Z80Bisect::Find(const Z80STATE *initial, ZQWORD steps, unsigned int checkpoint) {
+	checkpoint = std::max(checkpoint, 1u);
+	found = -1;
+
+	memcpy(good, initial, sizeof(Z80STATE));
+	Normalize(good);
+	if (!Same(0)) {
+		found = 0;
+		return found;
+	}
+
+	ZQWORD done = 0;
+
+	while (done < steps) {
+		unsigned int n = (unsigned int) std::min((ZQWORD) checkpoint, steps - done);
+
+		a->step(n);
+		b->step(n);
+		a->save(state_a);
+		b->save(state_b);
+		Normalize(state_a);
+		Normalize(state_b);
+
+		if (Hash(state_a) == Hash(state_b)) {
+			std::swap(good, state_a);
+			done += n;
+			continue;
+		}
+
+		// good is at done, the engines differ n instructions later
+		unsigned int lo = 0;
+		unsigned int hi = n;
+		while (hi - lo > 1) {
+			unsigned int mid = lo + (hi - lo) / 2;
+			if (Same(mid - lo)) {
+				std::swap(good, state_a);
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+
+		Same(1);
+		found = done + hi;
+		break;
+	}
+
+	return found;
+}
+
+
+
+// Register / flag / memory diff at the instruction Find() stopped at, the
+// way z80test shows a failed case
+
+void Z80Bisect::Show() {
+	if (found < 0) {
+		printf("No divergence found\n");
+		return;
+	}
+
+	const Z80STATE *s[2] = { state_a, state_b };
+	const char *label = "AB";
+
+	printf("DIVERGED AT INSTRUCTION %lld, CLOCK %llu\n", found, good->clock);
+	printf("PC %04x:", good->pc);
+	for (int i = 0; i < 4; i++) {
+		printf(" %02x", good->memory[(ZWORD) (good->pc + i)]);
+	}
+	printf("\n\n");
+
+	printf("    S  Z  Y  H  X P/V N  C  \n");
+	printf("   ------------------------\n");
+	for (int n = 0; n < 2; n++) {
+		ZBYTE f = s[n]->af & 0xff;
+		printf("%c | %d  %d  %d  %d  %d  %d  %d  %d |", label[n],
+			(f & FLAG_S) != 0, (f & FLAG_Z) != 0, (f & FLAG_Y) != 0, (f & FLAG_H) != 0,
+			(f & FLAG_X) != 0, (f & FLAG_PV) != 0, (f & FLAG_N) != 0, (f & FLAG_C) != 0);
+		if (n == 0) {
+			printf("       A = %s   B = %s", a->name, b->name);
+		}
+		printf("\n");
+	}
+	printf("   ------------------------\n\n");
+
+	printf("     PC    SP    AF    BC    DE    HL    AF'   BC'   DE'   HL'   IX    IY    WZ\n");
+	printf("   ------------------------------------------------------------------------------\n");
+	for (int n = 0; n < 2; n++) {
+		printf("%c | %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x  %04x |\n", label[n],
+			s[n]->pc, s[n]->sp, s[n]->af, s[n]->bc, s[n]->de, s[n]->hl,
+			s[n]->alt_af, s[n]->alt_bc, s[n]->alt_de, s[n]->alt_hl, s[n]->ix, s[n]->iy, s[n]->wz);
+	}
+	printf("   ------------------------------------------------------------------------------\n\n");
+
+	printf("    I   R   IFF1 IFF2  IM  halted  events       clock\n");
+	printf("   ---------------------------------------------------\n");
+	for (int n = 0; n < 2; n++) {
+		printf("%c | %02x  %02x  %d    %d     %d     %d       %02x  %12llu |\n", label[n],
+			s[n]->ir >> 8, s[n]->ir & 0xff, s[n]->iff1, s[n]->iff2, s[n]->im,
+			(s[n]->events & Z80EVENT_HALT) != 0, s[n]->events, s[n]->clock);
+	}
+	printf("   ---------------------------------------------------\n\n");
+
+	int first = 1;
+	for (unsigned int i = 0; i < 0xffff + 1; i++) {
+		if (state_a->memory[i] != state_b->memory[i]) {
+			if (first) {
+				printf("Address   A   B\n");
+				printf("----------------\n");
+				first = 0;
+			}
+			printf("%04x      %02x  %02x\n", i, state_a->memory[i], state_b->memory[i]);
+		}
+	}
+	printf("\n");
+}
+
+
+
+// FNV-1a over 64 bit words
+
+ZQWORD Z80Bisect::Hash(const Z80STATE *state) {
+	const ZBYTE *bytes = (const ZBYTE *) state;
+	ZQWORD hash = 0xcbf29ce484222325ULL;
+
+	for (size_t i = 0; i + 8 <= sizeof(Z80STATE); i += 8) {
+		ZQWORD word;
+		memcpy(&word, bytes + i, 8);
+		hash = (hash ^ word) * 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+
+
+// Both engines from good, steps instructions. Leaves their states in
+// state_a and state_b.
+
+bool Z80Bisect::Same(unsigned int steps) {
+	a->load(good);
+	b->load(good);
+	if (steps) {
+		a->step(steps);
+		b->step(steps);
+	}
+	a->save(state_a);
+	b->save(state_b);
+	Normalize(state_a);
+	Normalize(state_b);
+
+	return memcmp(state_a, state_b, sizeof(Z80STATE)) == 0;
+}
+
+
+
+// Leaves what's compared. Once cleared the state is a clean instruction
+// boundary, fine to load into any engine.
+
+void Z80Bisect::Normalize(Z80STATE *state) {
+	state->op = 0;
+	state->i_set = 0;
+	state->instruction = 0;
+	state->tstates_counter = 0;
+	state->mcycles_counter = 0;
+	state->last_mcycle_tstates = 0;
+	state->will_jump = 0;
+	state->ioreq = 0;
+	state->io_count = 0;
+	state->io_ready = 0;
+	state->io_value = 0;
+	state->bus_start = 0;
+	state->bus_offset = 0;
+	state->bus_gaps = 0;
+}
@@ -0,0 +1,261 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "z80dedup.h"
+
+
+Z80PageDedup::Z80PageDedup() {
+	bytes_saved.store(0);
+	passes.store(0);
+}
+
+
+Z80PageDedup::~Z80PageDedup() {
+	Stop();
+
+	for (auto page : canonical_pages) {
+		Z80Memory::ReleasePage(page);
+	}
+}
+
+
+
+void Z80PageDedup::Register(Z80Memory *mem) {
+	std::lock_guard<std::mutex> guard(lock);
+	memories.push_back(mem);
+}
+
+
+
+// Blocks until the current pass (if any) is done
+
+void Z80PageDedup::Unregister(Z80Memory *mem) {
+	std::lock_guard<std::mutex> guard(lock);
+	memories.erase(std::remove(memories.begin(), memories.end(), mem), memories.end());
+}
+
+
+
+void Z80PageDedup::Pass() {
+	std::lock_guard<std::mutex> guard(lock);
+
+	candidates.clear();
+	Purge();
+
+	for (auto mem : memories) {
+		for (int i = 0; i < Z80MEM_PAGES; i++) {
+			if (!Hold(mem)) {
+				break;	// Running again, leave it for the next pass
+			}
+			ScanPage(mem, i);
+			Release(mem);
+		}
+	}
+	candidates.clear();
+
+	ZQWORD saved = 0;
+	for (auto page : canonical_pages) {
+		int refs = page->refs.load(std::memory_order_relaxed);
+		if (refs > 2) {
+			saved += (refs - 2) * Z80MEM_PAGE_SIZE;	// One reference is ours, one is the copy we keep
+		}
+	}
+	bytes_saved.store(saved, std::memory_order_relaxed);
+	passes.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+
+void Z80PageDedup::ScanPage(Z80Memory *mem, int index) {
+	Z80PAGE *page = mem->pages[index];
+
+	if (canonical_pages.count(page)) {
+		return;
+	}
+
+	ZQWORD hash = Hash(page->data);
+
+	Z80PAGE *target = FindCanonical(hash, page);
+	if (target != nullptr) {
+		Merge(mem, index, target);
+		return;
+	}
+
+	auto found = candidates.find(hash);
+	if (found == candidates.end()) {
+		candidates[hash] = { mem, index, page };
+		return;
+	}
+
+	// Second copy seen: the first one becomes canonical, provided its owner
+	// is still parked and hasn't replaced the page in the meantime
+	CANDIDATE first = found->second;
+	if (first.page == page) {
+		return;
+	}
+
+	bool held = (first.mem == mem) || Hold(first.mem);
+	if (!held) {
+		found->second = { mem, index, page };
+		return;
+	}
+
+	if (first.mem->pages[first.index] == first.page && memcmp(first.page->data, page->data, Z80MEM_PAGE_SIZE) == 0) {
+		first.page->refs.fetch_add(1, std::memory_order_relaxed);
+		canonical.insert(std::make_pair(hash, first.page));
+		canonical_pages.insert(first.page);
+		candidates.erase(found);
+		target = first.page;
+	} else {
+		found->second = { mem, index, page };
+	}
+
+	if (first.mem != mem) {
+		Release(first.mem);
+	}
+
+	if (target != nullptr) {
+		Merge(mem, index, target);
+	}
+}
+
+
+
+Z80PAGE *Z80PageDedup::FindCanonical(ZQWORD hash, Z80PAGE *page) {
+	auto range = canonical.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (memcmp(it->second->data, page->data, Z80MEM_PAGE_SIZE) == 0) {
+			return it->second;
+		}
+	}
+	return nullptr;
+}
+
+
+
+void Z80PageDedup::Merge(Z80Memory *mem, int index, Z80PAGE *target) {
+	Z80PAGE *old = mem->pages[index];
+	if (old == target) {
+		return;
+	}
+	target->refs.fetch_add(1, std::memory_order_relaxed);
+	mem->pages[index] = target;
+	Z80Memory::ReleasePage(old);
+}
+
+
+
+// Drop canonical pages nobody but us references anymore
+
+void Z80PageDedup::Purge() {
+	for (auto it = canonical.begin(); it != canonical.end(); ) {
+		Z80PAGE *page = it->second;
+		if (page->refs.load(std::memory_order_acquire) == 1) {
+			canonical_pages.erase(page);
+			Z80Memory::ReleasePage(page);
+			it = canonical.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+
+
+void Z80PageDedup::Start(unsigned int interval_ms) {
+	if (running) {
+		return;
+	}
+	running = true;
+
+	worker = std::thread([this, interval_ms]() {
+#ifdef __linux__
+		struct sched_param param;
+		param.sched_priority = 0;
+		pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+		std::unique_lock<std::mutex> guard(worker_lock);
+		while (running) {
+			guard.unlock();
+			Pass();
+			guard.lock();
+			wakeup.wait_for(guard, std::chrono::milliseconds(interval_ms), [this]() { return !running; });
+		}
+	});
+}
+
+
+
+void Z80PageDedup::Stop() {
+	{
+		std::lock_guard<std::mutex> guard(worker_lock);
+		if (!running) {
+			return;
+		}
+		running = false;
+	}
+	wakeup.notify_all();
+	worker.join();
+}
+
+
+
+ZQWORD Z80PageDedup::GetBytesSaved() {
+	return bytes_saved.load(std::memory_order_relaxed);
+}
+
+
+
+ZQWORD Z80PageDedup::GetPasses() {
+	return passes.load(std::memory_order_relaxed);
+}
+
+
+
+bool Z80PageDedup::Hold(Z80Memory *mem) {
+	int expected = Z80Memory::PARKED;
+	return mem->state.compare_exchange_strong(expected, Z80Memory::REMAPPING, std::memory_order_acquire);
+}
+
+
+
+void Z80PageDedup::Release(Z80Memory *mem) {
+	mem->state.store(Z80Memory::PARKED, std::memory_order_release);
+}
+
+
+
+ZQWORD Z80PageDedup::Hash(const ZBYTE *data) {
+	ZQWORD hash = 0xcbf29ce484222325ULL;
+	for (int i = 0; i < Z80MEM_PAGE_SIZE; i += 8) {
+		ZQWORD word;
+		memcpy(&word, data + i, 8);
+		hash = (hash ^ word) * 0x100000001b3ULL;
+		hash ^= hash >> 29;
+	}
+	return hash;
+}
@@ -0,0 +1,97 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <string.h>
+
+#include "z80dma.h"
+
+
+Z80DMA::Z80DMA(Z80 *cpu) : cpu(cpu), mem(nullptr) {
+}
+
+
+Z80DMA::Z80DMA(Z80 *cpu, Z80Memory *mem) : cpu(cpu), mem(mem) {
+}
+
+
+
+void Z80DMA::SetByteTStates(unsigned int ts) {
+	byte_tstates = ts;
+}
+
+
+
+unsigned int Z80DMA::Copy(ZWORD dst, ZWORD src, unsigned int len) {
+
+	if (mem) {
+		mem->Copy(dst, src, len);
+		return Charge(len);
+	}
+
+	ZWORD distance = dst - src;
+	unsigned int done = 0;
+
+	// Chunks stop at the end of the address space and, when the destination
+	// starts inside the source, at the overlap distance
+	while (done < len) {
+		unsigned int chunk = std::min(len - done, 0x10000u - std::max(src, dst));
+		if (distance != 0 && distance < chunk) {
+			chunk = distance;
+		}
+
+		memmove(&cpu->memory[dst], &cpu->memory[src], chunk);
+		cpu->MarkDirty(dst, chunk);
+
+		src += chunk;
+		dst += chunk;
+		done += chunk;
+	}
+
+	return Charge(len);
+}
+
+
+
+unsigned int Z80DMA::Fill(ZWORD dst, ZBYTE val, unsigned int len) {
+
+	if (mem) {
+		mem->Fill(dst, val, len);
+		return Charge(len);
+	}
+
+	unsigned int done = 0;
+
+	while (done < len) {
+		unsigned int chunk = std::min(len - done, 0x10000u - dst);
+		memset(&cpu->memory[dst], val, chunk);
+		cpu->MarkDirty(dst, chunk);
+		dst += chunk;
+		done += chunk;
+	}
+
+	return Charge(len);
+}
+
+
+
+unsigned int Z80DMA::Charge(unsigned int len) {
+	unsigned int ts = len * byte_tstates;
+	cpu->BusRequest(ts);
+	return ts;
+}
@@ -0,0 +1,465 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+
+#include "z80explore.h"
+
+
+Z80Explorer::Z80Explorer(unsigned int inputs, unsigned int tstates, unsigned int threads) :
+	inputs(std::max(inputs, 1u)), tstates(tstates), threads(threads) {
+
+	if (this->threads == 0) {
+		this->threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	live_pages.store(0);
+	next.store(0);
+	stats = Z80EXPLORESTATS();
+
+	for (unsigned int i = 0; i < this->threads; i++) {
+		WORKER *worker = new WORKER;
+
+		worker->memory = new ZBYTE[sizeof(Z80ADDRESSBUS)]();
+		worker->cpu.memory = worker->memory;
+		worker->cpu.SetIOReadCallback([this, worker](ZWORD port) -> ZBYTE {
+			return InputCallback ? InputCallback(port, worker->input) : 0xff;
+		});
+		memset(worker->loaded, 0, sizeof(worker->loaded));
+		worker->hash = new Z80StateHash(&worker->cpu);
+		worker->hash->SetCounters(false);
+		worker->state = new Z80STATE();
+		worker->input = 0;
+		worker->duplicates = 0;
+		worker->steps = 0;
+
+		workers.push_back(worker);
+	}
+
+	for (unsigned int i = 1; i < this->threads; i++) {
+		helpers.push_back(std::thread(&Z80Explorer::Helper, this, workers[i]));
+	}
+}
+
+
+
+Z80Explorer::~Z80Explorer() {
+	{
+		std::lock_guard<std::mutex> guard(round_lock);
+		stopping = true;
+	}
+	round_start.notify_all();
+	for (auto &helper : helpers) {
+		helper.join();
+	}
+
+	Clear();
+
+	for (auto worker : workers) {
+		delete worker->state;
+		delete worker->hash;
+		delete[] worker->memory;
+		delete worker;
+	}
+}
+
+
+
+// Gives the value an IN returns while trying an input, 0xff if not set
+
+void Z80Explorer::SetInputCallback(INPUTFUNCTION cb) {
+	InputCallback = cb;
+}
+
+
+
+// Called on the loaded state before every step
+
+void Z80Explorer::SetStepCallback(STEPFUNCTION cb) {
+	StepCallback = cb;
+}
+
+
+
+// Higher goes first. Turns the search from breadth first into best-first.
+
+void Z80Explorer::SetScoreCallback(SCOREFUNCTION cb) {
+	ScoreCallback = cb;
+}
+
+
+
+void Z80Explorer::SetGoalCallback(GOALFUNCTION cb) {
+	GoalCallback = cb;
+}
+
+
+
+// States expanded per round, spread over the workers
+
+void Z80Explorer::SetBatch(unsigned int states) {
+	batch = std::max(states, 1u);
+}
+
+
+
+// Searches from initial until a state passes the goal callback, max_states
+// states were found, or no state above max_depth steps is left. Returns the
+// id of the goal state, 0 if initial is one, -1 if none was found. Forgets
+// the previous search.
+
+long long Z80Explorer::Explore(const Z80STATE *initial, ZQWORD max_states, unsigned int max_depth) {
+	auto start = std::chrono::steady_clock::now();
+
+	Clear();
+
+	NODE *root = new NODE;
+	root->id = 0;
+	root->score = 0;
+	memcpy(root->state, initial, Z80EXPLORE_HEADER);
+	for (int i = 0; i < Z80HASH_PAGES; i++) {
+		root->pages[i] = new PAGE;
+		root->pages[i]->refs.store(1);
+		memcpy(root->pages[i]->data, &initial->memory[i << Z80HASH_PAGE_BITS], Z80HASH_PAGE_SIZE);
+	}
+	live_pages += Z80HASH_PAGES;
+
+	WORKER *first = workers[0];
+	if (first->cpu.LoadState(initial, false)) {
+		Release(root);
+		return -1;
+	}
+	Load(first, root);
+
+	seen.insert(first->hash->Update());
+	records.push_back(RECORD{-1, 0, 0});
+	stats.states = 1;
+
+	long long goal = -1;
+	if (GoalCallback && GoalCallback(&first->cpu)) {
+		goal = 0;
+	}
+	if (ScoreCallback) {
+		root->score = ScoreCallback(&first->cpu);
+		best.push(root);
+	} else {
+		fifo.push_back(root);
+	}
+
+	while (goal < 0 && records.size() < max_states && !(fifo.empty() && best.empty())) {
+
+		parents.clear();
+		while (parents.size() < batch && !(fifo.empty() && best.empty())) {
+			NODE *node;
+			if (ScoreCallback) {
+				node = best.top();
+				best.pop();
+			} else {
+				node = fifo.front();
+				fifo.pop_front();
+			}
+
+			if (records[node->id].depth < max_depth) {
+				parents.push_back(node);
+			} else {
+				Release(node);
+			}
+		}
+
+		// Workers take parents in turn, children land in fixed slots
+		unsigned int count = parents.size();
+		children.assign((size_t) count * inputs, CHILD{nullptr, {0, 0}, false});
+		next.store(0);
+
+		{
+			std::lock_guard<std::mutex> guard(round_lock);
+			round++;
+			busy = helpers.size();
+		}
+		round_start.notify_all();
+
+		Work(first);
+
+		{
+			std::unique_lock<std::mutex> guard(round_lock);
+			round_done.wait(guard, [this]() { return busy == 0; });
+		}
+
+		// Merge in slot order, same result with any number of threads
+		for (size_t i = 0; i < children.size(); i++) {
+			CHILD &child = children[i];
+			if (child.node == nullptr) {
+				continue;
+			}
+
+			if (records.size() >= max_states || !seen.insert(child.fingerprint).second) {
+				if (records.size() < max_states) {
+					stats.duplicates++;
+				}
+				Release(child.node);
+				continue;
+			}
+
+			const NODE *parent = parents[i / inputs];
+			unsigned int depth = records[parent->id].depth + 1;
+
+			child.node->id = records.size();
+			records.push_back(RECORD{parent->id, (unsigned int) (i % inputs), depth});
+			stats.depth = std::max(stats.depth, depth);
+
+			if (child.goal && goal < 0) {
+				goal = child.node->id;
+			}
+			if (ScoreCallback) {
+				best.push(child.node);
+			} else {
+				fifo.push_back(child.node);
+			}
+		}
+
+		for (auto parent : parents) {
+			Release(parent);
+		}
+		stats.expanded += count;
+		stats.peak_pages = std::max(stats.peak_pages, (ZQWORD) live_pages.load());
+	}
+
+	stats.states = records.size();
+	stats.steps = 0;
+	for (auto worker : workers) {
+		stats.steps += worker->steps;
+		stats.duplicates += worker->duplicates;
+		worker->steps = worker->duplicates = 0;
+	}
+	stats.pages = live_pages.load();
+	stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	return goal;
+}
+
+
+
+// Inputs that lead from the initial state to state id, in order
+
+std::vector<unsigned int> Z80Explorer::GetPath(long long id) {
+	std::vector<unsigned int> path;
+
+	if (id < 0 || id >= (long long) records.size()) {
+		return path;
+	}
+	for (; records[id].parent >= 0; id = records[id].parent) {
+		path.push_back(records[id].input);
+	}
+	std::reverse(path.begin(), path.end());
+
+	return path;
+}
+
+
+
+Z80EXPLORESTATS Z80Explorer::GetStats() {
+	return stats;
+}
+
+
+
+unsigned int Z80Explorer::GetThreads() {
+	return threads;
+}
+
+
+
+// Helper thread body: one Work() per round until the explorer goes away
+
+void Z80Explorer::Helper(WORKER *worker) {
+	unsigned int last = 0;
+
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> guard(round_lock);
+			round_start.wait(guard, [this, last]() { return stopping || round != last; });
+			if (stopping) {
+				return;
+			}
+			last = round;
+		}
+
+		Work(worker);
+
+		{
+			std::lock_guard<std::mutex> guard(round_lock);
+			busy--;
+		}
+		round_done.notify_one();
+	}
+}
+
+
+
+// Takes parents of the current batch until none is left
+
+void Z80Explorer::Work(WORKER *worker) {
+	unsigned int count = parents.size();
+	for (unsigned int i = next++; i < count; i = next++) {
+		Expand(worker, parents[i], &children[(size_t) i * inputs]);
+	}
+}
+
+
+
+// Registers from the node, and only the pages the worker's memory doesn't
+// hold already. Siblings share most pages, so this is usually a handful.
+
+void Z80Explorer::Load(WORKER *worker, const NODE *node) {
+	memcpy(worker->state, node->state, Z80EXPLORE_HEADER);
+	worker->cpu.LoadState(worker->state, false);
+
+	for (int i = 0; i < Z80HASH_PAGES; i++) {
+		PAGE *page = node->pages[i];
+		if (worker->loaded[i] != page) {
+			memcpy(&worker->memory[i << Z80HASH_PAGE_BITS], page->data, Z80HASH_PAGE_SIZE);
+			page->refs++;
+			Drop(worker->loaded[i]);
+			worker->loaded[i] = page;
+			worker->hash->Touch(i << Z80HASH_PAGE_BITS, Z80HASH_PAGE_SIZE);
+		}
+	}
+}
+
+
+
+void Z80Explorer::Expand(WORKER *worker, const NODE *node, CHILD *children) {
+	for (unsigned int input = 0; input < inputs; input++) {
+		Load(worker, node);
+
+		worker->input = input;
+		if (StepCallback) {
+			StepCallback(&worker->cpu);
+		}
+		worker->cpu.ExecuteTStates(tstates);
+		worker->steps++;
+
+		ZQWORD written[4] = {0, 0, 0, 0};
+		worker->cpu.TakeDirtyPages(written);
+		for (int i = 0; i < Z80HASH_PAGES; i++) {
+			if (written[i >> 6] & (1ULL << (i & 63))) {
+				Drop(worker->loaded[i]);
+				worker->loaded[i] = nullptr;
+				worker->hash->Touch(i << Z80HASH_PAGE_BITS, Z80HASH_PAGE_SIZE);
+			}
+		}
+
+		// Nobody inserts into seen while workers run
+		Z80FINGERPRINT fingerprint = worker->hash->Update();
+		if (seen.count(fingerprint)) {
+			worker->duplicates++;
+			continue;
+		}
+
+		NODE *child = Fork(worker, node, written);
+		if (ScoreCallback) {
+			child->score = ScoreCallback(&worker->cpu);
+		}
+		children[input].node = child;
+		children[input].fingerprint = fingerprint;
+		children[input].goal = GoalCallback && GoalCallback(&worker->cpu);
+	}
+}
+
+
+
+// The worker's state as a new node. Pages the step didn't change (written
+// with the same bytes included) are shared with the parent.
+
+Z80Explorer::NODE *Z80Explorer::Fork(WORKER *worker, const NODE *parent, const ZQWORD written[4]) {
+	NODE *node = new NODE;
+
+	node->id = -1;
+	node->score = 0;
+	worker->cpu.SaveState(worker->state, false);
+	memcpy(node->state, worker->state, Z80EXPLORE_HEADER);
+
+	for (int i = 0; i < Z80HASH_PAGES; i++) {
+		PAGE *page = parent->pages[i];
+		const ZBYTE *data = &worker->memory[i << Z80HASH_PAGE_BITS];
+
+		if ((written[i >> 6] & (1ULL << (i & 63))) && memcmp(page->data, data, Z80HASH_PAGE_SIZE)) {
+			page = new PAGE;
+			page->refs.store(1);
+			memcpy(page->data, data, Z80HASH_PAGE_SIZE);
+			live_pages++;
+		} else {
+			page->refs++;
+		}
+		node->pages[i] = page;
+
+		if (worker->loaded[i] != page) {
+			page->refs++;
+			Drop(worker->loaded[i]);
+			worker->loaded[i] = page;
+		}
+	}
+
+	return node;
+}
+
+
+
+void Z80Explorer::Release(NODE *node) {
+	for (int i = 0; i < Z80HASH_PAGES; i++) {
+		Drop(node->pages[i]);
+	}
+	delete node;
+}
+
+
+
+void Z80Explorer::Drop(PAGE *page) {
+	if (page && --page->refs == 0) {
+		delete page;
+		live_pages--;
+	}
+}
+
+
+
+// Frees the states left from the previous search
+
+void Z80Explorer::Clear() {
+	for (auto node : fifo) {
+		Release(node);
+	}
+	fifo.clear();
+	while (!best.empty()) {
+		Release(best.top());
+		best.pop();
+	}
+
+	for (auto worker : workers) {
+		for (int i = 0; i < Z80HASH_PAGES; i++) {
+			Drop(worker->loaded[i]);
+			worker->loaded[i] = nullptr;
+		}
+		worker->steps = worker->duplicates = 0;
+	}
+
+	records.clear();
+	seen.clear();
+	stats = Z80EXPLORESTATS();
+}
@@ -0,0 +1,188 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+
+#include "z80hash.h"
+
+
+#define HASH_LANES		8
+#define HASH_BLOCK		(HASH_LANES * 8)
+#define HASH_PRIME1		0x9e3779b185ebca87ULL
+#define HASH_PRIME2		0xc2b2ae3d27d4eb4fULL
+
+
+static const ZQWORD keys[HASH_LANES] = {
+	0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+	0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL, 0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL
+};
+
+
+// One 64 byte block into the accumulators. Lanes are independent, so this
+// vectorizes (PMULUDQ on SSE2).
+static inline void Accumulate(ZQWORD *acc, const ZBYTE *block) {
+	ZQWORD word[HASH_LANES];
+	memcpy(word, block, HASH_BLOCK);
+
+	for (int i = 0; i < HASH_LANES; i++) {
+		ZQWORD x = word[i] ^ keys[i];
+		acc[i ^ 1] += word[i];
+		acc[i] += (x & 0xffffffff) * (x >> 32);
+	}
+}
+
+
+
+// Every page starts out pending, the first Update() hashes them all
+
+Z80StateHash::Z80StateHash(Z80 *cpu) : cpu(cpu) {
+	memset(pages, 0, sizeof(pages));
+	memory.lo = memory.hi = 0;
+	state = new Z80STATE();
+
+	Invalidate();
+}
+
+
+
+Z80StateHash::~Z80StateHash() {
+	delete state;
+}
+
+
+
+// Whether the clock and I/O count are part of the fingerprint (they are by
+// default). Turn it off to match states reached at different times.
+
+void Z80StateHash::SetCounters(bool on) {
+	counters = on;
+}
+
+
+
+// Counts pages from the one addr falls in, so an unaligned start still
+// reaches the page of the last byte. Wraps at 64 KB.
+
+void Z80StateHash::Touch(ZWORD addr, unsigned int len) {
+	if (len == 0) {
+		return;
+	}
+
+	unsigned int first = addr >> Z80HASH_PAGE_BITS;
+	unsigned int pages = Z80HASH_PAGES;
+	if (len < 0x10000) {
+		pages = std::min(((addr & (Z80HASH_PAGE_SIZE - 1)) + len - 1) / Z80HASH_PAGE_SIZE + 1, pages);
+	}
+	for (unsigned int i = 0; i < pages; i++) {
+		unsigned int page = (first + i) % Z80HASH_PAGES;
+		pending[page >> 6] |= 1ULL << (page & 63);
+	}
+}
+
+
+
+void Z80StateHash::Invalidate() {
+	pending[0] = pending[1] = pending[2] = pending[3] = ~0ULL;
+}
+
+
+
+Z80FINGERPRINT Z80StateHash::Update() {
+	cpu->TakeDirtyPages(pending);
+
+	for (int word = 0; word < 4; word++) {
+		while (pending[word]) {
+			int page = (word << 6) | __builtin_ctzll(pending[word]);
+			pending[word] &= pending[word] - 1;
+
+			Z80FINGERPRINT h = Position(Hash(&cpu->memory[page << Z80HASH_PAGE_BITS], Z80HASH_PAGE_SIZE, 0), page);
+			memory.lo += h.lo - pages[page].lo;
+			memory.hi += h.hi - pages[page].hi;
+			pages[page] = h;
+		}
+	}
+
+	cpu->SaveState(state, false);
+	if (!counters) {
+		state->clock = 0;
+		state->io_count = 0;
+	}
+
+	Z80FINGERPRINT regs = Hash((const ZBYTE *) state, offsetof(Z80STATE, memory), 1);
+	Z80FINGERPRINT fp;
+	fp.lo = Mix(memory.lo ^ regs.lo);
+	fp.hi = Mix(memory.hi ^ regs.hi);
+
+	return fp;
+}
+
+
+
+// Any length, in 64 byte blocks
+
+Z80FINGERPRINT Z80StateHash::Hash(const ZBYTE *data, size_t len, ZQWORD seed) {
+	ZQWORD acc[HASH_LANES];
+	for (int i = 0; i < HASH_LANES; i++) {
+		acc[i] = keys[i] ^ seed;
+	}
+
+	size_t blocks = len / HASH_BLOCK;
+	for (size_t b = 0; b < blocks; b++) {
+		Accumulate(acc, data + b * HASH_BLOCK);
+	}
+
+	// Tail, zero padded
+	if (len % HASH_BLOCK) {
+		ZBYTE last[HASH_BLOCK] = {};
+		memcpy(last, data + blocks * HASH_BLOCK, len % HASH_BLOCK);
+		Accumulate(acc, last);
+	}
+
+	Z80FINGERPRINT h;
+	h.lo = len * HASH_PRIME1;
+	h.hi = seed ^ len;
+	for (int i = 0; i < HASH_LANES / 2; i++) {
+		h.lo = Mix(h.lo ^ acc[i]);
+		h.hi = Mix(h.hi ^ acc[i + HASH_LANES / 2]);
+	}
+
+	return h;
+}
+
+
+
+// Same page contents at different addresses sum to different values
+
+Z80FINGERPRINT Z80StateHash::Position(Z80FINGERPRINT page, unsigned int n) {
+	Z80FINGERPRINT h;
+	h.lo = Mix(page.lo + n * HASH_PRIME1);
+	h.hi = Mix(page.hi + n * HASH_PRIME2);
+	return h;
+}
+
+
+
+// Final mix of murmur3 / splitmix
+ZQWORD Z80StateHash::Mix(ZQWORD h) {
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
@@ -0,0 +1,68 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+
+#include "z80iolog.h"
+
+
+Z80IOLog::Z80IOLog(unsigned int capacity) : events(capacity) {
+	for (int i = 0; i < 256; i++) {
+		ports[i] = false;
+	}
+}
+
+
+
+void Z80IOLog::BufferPort(ZBYTE port, bool buffered) {
+	ports[port] = buffered;
+}
+
+
+
+void Z80IOLog::Clear() {
+	count = 0;
+	overflows = 0;
+}
+
+
+
+// Doubles the log. Slow path, writes queued so far keep their place.
+
+void Z80IOLog::Grow() {
+	overflows++;
+	events.resize(std::max<size_t>(events.size() * 2, 16));
+}
+
+
+
+unsigned int Z80IOLog::Size() const {
+	return count;
+}
+
+
+
+const Z80IOEVENT *Z80IOLog::Events() const {
+	return events.data();
+}
+
+
+
+unsigned int Z80IOLog::Overflows() const {
+	return overflows;
+}
@@ -0,0 +1,221 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+
+#include "z80machine.h"
+
+
+#define BARRIER_SPINS	1000
+
+
+Z80Barrier::Z80Barrier(unsigned int parties) : parties(parties) {
+	waiting.store(0);
+	generation.store(0);
+}
+
+
+
+void Z80Barrier::Wait() {
+	unsigned int gen = generation.load(std::memory_order_acquire);
+
+	if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == parties) {
+		waiting.store(0, std::memory_order_relaxed);
+		generation.store(gen + 1, std::memory_order_release);
+		return;
+	}
+
+	for (unsigned int spins = 0; generation.load(std::memory_order_acquire) == gen; spins++) {
+		if (spins >= BARRIER_SPINS) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+
+
+Z80Machine::Z80Machine() {
+	contention.store(false);
+}
+
+
+Z80Machine::~Z80Machine() {
+	StopThreads();
+}
+
+
+
+void Z80Machine::Add(Z80 *cpu) {
+	StopThreads();
+	cpus.push_back(cpu);
+	offsets.push_back(cpu->GetClock() - time);
+}
+
+
+
+void Z80Machine::SetQuantum(unsigned int ts) {
+	quantum = current = std::max(ts, 1u);
+	min_quantum = std::min(min_quantum, quantum);
+}
+
+
+
+void Z80Machine::SetMinQuantum(unsigned int ts) {
+	min_quantum = std::min(std::max(ts, 1u), quantum);
+}
+
+
+
+void Z80Machine::SetThreaded(bool on) {
+	if (!on) {
+		StopThreads();
+	}
+	threaded = on;
+}
+
+
+
+// Safe to call from any CPU's thread
+
+void Z80Machine::SharedAccess() {
+	contention.store(true, std::memory_order_relaxed);
+}
+
+
+
+ZQWORD Z80Machine::GetTime() {
+	return time;
+}
+
+
+
+unsigned int Z80Machine::GetCurrentQuantum() {
+	return current;
+}
+
+
+
+// Returns how far the machine time got. A CPU suspended on an async IN
+// stays where it is while the others finish the quantum, then Run() returns;
+// it catches up in the first quantum of the next Run() after ResumeIO().
+
+ZQWORD Z80Machine::Run(ZQWORD tstates) {
+	ZQWORD start = time;
+	ZQWORD end = time + tstates;
+
+	if (threaded && cpus.size() > 1 && barrier == nullptr) {
+		StartThreads();
+	}
+
+	while (time < end) {
+		target = std::min(time + current, end);
+
+		if (barrier != nullptr) {
+			barrier->Wait();		// Quantum start
+			RunCPU(0);
+			barrier->Wait();		// Everybody reached the target
+		} else {
+			for (unsigned int i = 0; i < cpus.size(); i++) {
+				RunCPU(i);
+			}
+		}
+
+		time = target;
+		NextQuantum();
+
+		if (Suspended()) {
+			break;
+		}
+	}
+
+	return time - start;
+}
+
+
+
+void Z80Machine::RunCPU(unsigned int n) {
+	Z80 *cpu = cpus[n];
+	ZQWORD goal = target + offsets[n];
+
+	while (cpu->GetClock() < goal) {
+		if (cpu->ExecuteTStates((unsigned int) std::min(goal - cpu->GetClock(), (ZQWORD) 0x7fffffff)) == 0) {
+			break;		// Suspended on an IN
+		}
+	}
+}
+
+
+
+bool Z80Machine::Suspended() {
+	for (Z80 *cpu : cpus) {
+		if (cpu->isSuspended()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+
+void Z80Machine::NextQuantum() {
+	if (contention.exchange(false, std::memory_order_relaxed)) {
+		current = min_quantum;
+	} else {
+		current = std::min(current * 2, quantum);
+	}
+}
+
+
+
+void Z80Machine::StartThreads() {
+	stopping = false;
+	barrier = new Z80Barrier(cpus.size());
+
+	for (unsigned int i = 1; i < cpus.size(); i++) {
+		workers.push_back(std::thread([this, i]() {
+			while (true) {
+				barrier->Wait();
+				if (stopping) {
+					break;
+				}
+				RunCPU(i);
+				barrier->Wait();
+			}
+		}));
+	}
+}
+
+
+
+void Z80Machine::StopThreads() {
+	if (barrier == nullptr) {
+		return;
+	}
+
+	stopping = true;
+	barrier->Wait();
+
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+
+	delete barrier;
+	barrier = nullptr;
+}
@@ -0,0 +1,180 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <string.h>
+#include <thread>
+
+#include "z80memory.h"
+
+
+Z80Memory::Z80Memory() {
+	for (int i = 0; i < Z80MEM_PAGES; i++) {
+		pages[i] = NewPage();
+		memset(pages[i]->data, 0, Z80MEM_PAGE_SIZE);
+	}
+	state.store(RUNNING, std::memory_order_relaxed);
+}
+
+
+Z80Memory::~Z80Memory() {
+	for (int i = 0; i < Z80MEM_PAGES; i++) {
+		ReleasePage(pages[i]);
+	}
+}
+
+
+
+Z80PAGE *Z80Memory::NewPage() {
+	Z80PAGE *page = new Z80PAGE;
+	page->refs.store(1, std::memory_order_relaxed);
+	return page;
+}
+
+
+
+void Z80Memory::ReleasePage(Z80PAGE *page) {
+	if (page->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		delete page;
+	}
+}
+
+
+
+Z80PAGE *Z80Memory::Unshare(int index) {
+	Z80PAGE *page = NewPage();
+	memcpy(page->data, pages[index]->data, Z80MEM_PAGE_SIZE);
+	ReleasePage(pages[index]);
+	pages[index] = page;
+	return page;
+}
+
+
+
+void Z80Memory::Load(ZWORD addr, const ZBYTE *src, unsigned int len) {
+	for (unsigned int i = 0; i < len; i++) {
+		Write(addr + i, src[i]);
+	}
+}
+
+
+
+void Z80Memory::Save(ZWORD addr, ZBYTE *dst, unsigned int len) {
+	for (unsigned int i = 0; i < len; i++) {
+		dst[i] = Read(addr + i);
+	}
+}
+
+
+
+void Z80Memory::Fill(ZBYTE val) {
+	for (int i = 0; i < Z80MEM_PAGES; i++) {
+		if (pages[i]->refs.load(std::memory_order_relaxed) != 1) {
+			Unshare(i);
+		}
+		memset(pages[i]->data, val, Z80MEM_PAGE_SIZE);
+	}
+}
+
+
+
+void Z80Memory::Fill(ZWORD addr, ZBYTE val, unsigned int len) {
+	while (len > 0) {
+		unsigned int offset = addr & Z80MEM_PAGE_MASK;
+		unsigned int chunk = std::min(len, Z80MEM_PAGE_SIZE - offset);
+
+		Write(addr, val);		// Unshares the page
+		memset(&pages[addr >> Z80MEM_PAGE_BITS]->data[offset], val, chunk);
+
+		addr += chunk;
+		len -= chunk;
+	}
+}
+
+
+
+// Same result as copying byte by byte upwards, like LDIR or a DMA: when the
+// destination starts inside the source the pattern repeats. Done a page (or
+// overlap distance) at a time with memmove.
+
+void Z80Memory::Copy(ZWORD dst, ZWORD src, unsigned int len) {
+	ZWORD distance = dst - src;
+
+	while (len > 0) {
+		unsigned int src_left = Z80MEM_PAGE_SIZE - (src & Z80MEM_PAGE_MASK);
+		unsigned int dst_left = Z80MEM_PAGE_SIZE - (dst & Z80MEM_PAGE_MASK);
+		unsigned int chunk = std::min(len, std::min(src_left, dst_left));
+		if (distance != 0 && distance < chunk) {
+			chunk = distance;
+		}
+
+		Write(dst, Read(dst));	// Unshares the page
+		memmove(&pages[dst >> Z80MEM_PAGE_BITS]->data[dst & Z80MEM_PAGE_MASK],
+			&pages[src >> Z80MEM_PAGE_BITS]->data[src & Z80MEM_PAGE_MASK], chunk);
+
+		src += chunk;
+		dst += chunk;
+		len -= chunk;
+	}
+}
+
+
+
+unsigned int Z80Memory::SharedPages() {
+	unsigned int count = 0;
+	for (int i = 0; i < Z80MEM_PAGES; i++) {
+		if (pages[i]->refs.load(std::memory_order_relaxed) != 1) {
+			count++;
+		}
+	}
+	return count;
+}
+
+
+
+// Called by the owner thread when the instance goes idle. Until Unpark()
+// the page table belongs to background passes.
+
+void Z80Memory::Park() {
+	state.store(PARKED, std::memory_order_release);
+}
+
+
+
+// A background pass holds the table for one page at a time, so this never
+// waits longer than a single page compare
+
+void Z80Memory::Unpark() {
+	int expected = PARKED;
+	while (!state.compare_exchange_weak(expected, RUNNING, std::memory_order_acquire)) {
+		if (expected == RUNNING) {
+			return;
+		}
+		expected = PARKED;
+		std::this_thread::yield();
+	}
+}
+
+
+
+#ifdef __Z80MEMCALLBACKS__
+void Z80Memory::Attach(Z80 *cpu) {
+	cpu->SetMemReadCallback([this](ZWORD addr) { return Read(addr); });
+	cpu->SetMemWriteCallback([this](ZWORD addr, ZBYTE val) { Write(addr, val); });
+}
+#endif
@@ -0,0 +1,192 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80pacer.h"
+
+
+#define NS_PER_SECOND	1000000000ULL
+
+
+Z80Pacer::Z80Pacer(Z80 *cpu, ZQWORD hz) : cpu(cpu), hz(hz) {
+	ClearStats();
+	Resync();
+}
+
+
+
+void Z80Pacer::SetSpinThreshold(ZQWORD ns) {
+	spin_threshold = ns;
+}
+
+
+
+void Z80Pacer::SetMaxLag(ZQWORD ns) {
+	max_lag = ns;
+}
+
+
+
+void Z80Pacer::SetTurbo(bool on) {
+	if (turbo && !on) {
+		Resync();
+	}
+	turbo = on;
+}
+
+
+
+void Z80Pacer::SetHaltSleep(bool on) {
+	halt_sleep = on;
+}
+
+
+
+unsigned int Z80Pacer::Run(unsigned int ts) {
+	unsigned int executed = cpu->ExecuteTStates(ts);
+	Pace();
+	return executed;
+}
+
+
+
+// Ties the current CPU clock to the current wall time
+
+void Z80Pacer::Resync() {
+	base_ns = Now();
+	base_clock = cpu->GetClock();
+}
+
+
+
+// Waits until wall time catches up with the CPU clock
+
+void Z80Pacer::Pace() {
+
+	if (turbo) {
+		Resync();
+		return;
+	}
+
+	ZQWORD elapsed = cpu->GetClock() - base_clock;
+
+	// Move the base forward a whole second at a time, keeps the products small
+	if (elapsed >= hz) {
+		ZQWORD seconds = elapsed / hz;
+		base_clock += seconds * hz;
+		base_ns += seconds * NS_PER_SECOND;
+		elapsed -= seconds * hz;
+	}
+
+	ZQWORD target = base_ns + (elapsed * NS_PER_SECOND) / hz;
+	ZQWORD now = Now();
+
+	if (now >= target) {
+		if (now - target > max_lag) {
+			stats.resyncs++;
+			Resync();
+			return;
+		}
+		stats.late++;
+		Record((long long) (now - target));
+		return;
+	}
+
+	bool spin = !(halt_sleep && cpu->isHalted());
+
+	if (!spin) {
+		SleepUntil(target);
+	} else {
+		if (target - now > spin_threshold) {
+			SleepUntil(target - spin_threshold);
+		}
+		while (Now() < target) {
+			// Spin
+		}
+	}
+
+	stats.waits++;
+	Record((long long) Now() - (long long) target);
+}
+
+
+
+void Z80Pacer::Record(long long error) {
+	ZQWORD count = stats.waits + stats.late;
+
+	if (count == 1 || error < stats.min_error) {
+		stats.min_error = error;
+	}
+	if (count == 1 || error > stats.max_error) {
+		stats.max_error = error;
+	}
+
+	double delta = error - stats.mean_error;
+	stats.mean_error += delta / count;
+	stats.m2_error += delta * (error - stats.mean_error);
+
+	ZQWORD us = (error < 0 ? -error : error) / 1000;
+	int bucket = 0;
+	while (us > 0 && bucket < Z80PACER_BUCKETS - 1) {
+		us >>= 1;
+		bucket++;
+	}
+	stats.histogram[bucket]++;
+}
+
+
+
+const Z80PACERSTATS &Z80Pacer::GetStats() {
+	return stats;
+}
+
+
+
+double Z80Pacer::StdDev() {
+	ZQWORD count = stats.waits + stats.late;
+	return count > 1 ? sqrt(stats.m2_error / (count - 1)) : 0.0;
+}
+
+
+
+void Z80Pacer::ClearStats() {
+	memset(&stats, 0, sizeof(stats));
+}
+
+
+
+ZQWORD Z80Pacer::Now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ZQWORD) ts.tv_sec * NS_PER_SECOND + ts.tv_nsec;
+}
+
+
+
+void Z80Pacer::SleepUntil(ZQWORD ns) {
+	struct timespec ts;
+	ts.tv_sec = ns / NS_PER_SECOND;
+	ts.tv_nsec = ns % NS_PER_SECOND;
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+		// Interrupted by a signal, go back to sleep
+	}
+}
@@ -0,0 +1,138 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include "z80ports.h"
+
+
+// Takes over the CPU's I/O callbacks. Add devices before running it.
+
+Z80Ports::Z80Ports(Z80 *cpu) : cpu(cpu) {
+	for (int i = 0; i < 256; i++) {
+		routes[i] = Z80PORTS_UNROUTED;
+		latches[i].store(0xff);
+	}
+
+	cpu->SetIOReadCallback(std::bind(&Z80Ports::IORead, this, std::placeholders::_1));
+	cpu->SetIOWriteCallback(std::bind(&Z80Ports::IOWrite, this, std::placeholders::_1, std::placeholders::_2));
+}
+
+
+
+Z80Ports::~Z80Ports() {
+	for (auto device : devices) {
+		delete device->ring;
+		delete device;
+	}
+}
+
+
+
+// Returns the device number for Route() and Pop(). policy says what to do
+// with an OUT that finds the ring full, fallback takes them for
+// Z80PORTS_SYNC (without one they're dropped).
+
+int Z80Ports::AddDevice(unsigned int capacity, int policy, FALLBACK fallback) {
+	DEVICE *device = new DEVICE;
+
+	device->ring = new Z80SPSC<Z80IOEVENT>(capacity);
+	device->policy = policy;
+	device->fallback = fallback;
+	device->dropped.store(0);
+	device->overflows.store(0);
+	devices.push_back(device);
+
+	return devices.size() - 1;
+}
+
+
+
+void Z80Ports::Route(ZBYTE port, int device) {
+	routes[port] = device;
+}
+
+
+
+void Z80Ports::SetLatch(ZBYTE port, ZBYTE value) {
+	latches[port].store(value, std::memory_order_release);
+}
+
+
+
+bool Z80Ports::Pop(int device, Z80IOEVENT &ev) {
+	return devices[device]->ring->Pop(ev);
+}
+
+
+
+ZQWORD Z80Ports::Dropped(int device) {
+	return devices[device]->dropped.load(std::memory_order_relaxed);
+}
+
+
+
+ZQWORD Z80Ports::Overflows(int device) {
+	return devices[device]->overflows.load(std::memory_order_relaxed);
+}
+
+
+
+ZBYTE Z80Ports::IORead(ZWORD port) {
+	return latches[port & 0xff].load(std::memory_order_acquire);
+}
+
+
+
+void Z80Ports::IOWrite(ZWORD port, ZBYTE value) {
+	int device = routes[port & 0xff];
+
+	if (device == Z80PORTS_UNROUTED) {
+		return;
+	}
+
+	Z80IOEVENT ev;
+	ev.tstate = cpu->GetClock();
+	ev.port = port;
+	ev.value = value;
+
+	DEVICE *dev = devices[device];
+	if (dev->ring->Push(ev)) {
+		return;
+	}
+
+	dev->overflows.fetch_add(1, std::memory_order_relaxed);
+
+	switch (dev->policy) {
+		case Z80PORTS_BLOCK:
+			while (!dev->ring->Push(ev)) {
+				std::this_thread::yield();
+			}
+			break;
+
+		case Z80PORTS_SYNC:
+			if (dev->fallback) {
+				dev->fallback(ev);
+				break;
+			}
+			// Falls through
+
+		default:
+			dev->dropped.fetch_add(1, std::memory_order_relaxed);
+			break;
+	}
+}
@@ -0,0 +1,248 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "z80record.h"
+
+
+Z80Recorder::Z80Recorder() {}
+
+
+
+// Clears the stream and starts logging at the CPU's current clock
+
+void Z80Recorder::Start(Z80 *cpu) {
+	this->cpu = cpu;
+
+	stream.clear();
+	last_tstate = cpu->GetClock();
+	last_port = 0;
+	events = 0;
+
+	cpu->SetRecorder(this);
+}
+
+
+
+void Z80Recorder::Stop() {
+	if (cpu) {
+		cpu->SetRecorder(nullptr);
+		cpu = nullptr;
+	}
+}
+
+
+
+const std::vector<ZBYTE> &Z80Recorder::GetStream() {
+	return stream;
+}
+
+
+
+ZQWORD Z80Recorder::GetEvents() {
+	return events;
+}
+
+
+
+Z80Replayer::Z80Replayer(Z80 *cpu, const ZBYTE *stream, size_t size) : cpu(cpu), stream(stream), size(size) {
+	in.pos = 0;
+	in.tstate = cpu->GetClock();
+	in.port = 0;
+	irq = in;
+
+	in_valid = Next(in, true);
+	irq_valid = Next(irq, false);
+
+	cpu->SetIOReadAsyncCallback(nullptr);
+	cpu->SetIOReadCallback([this](ZWORD port) { return Read(port); });
+	cpu->SetIRQAckCallback([this]() { return Acknowledge(); });
+}
+
+
+
+// Runs in slices ending at the recorded acceptances and stalls
+
+unsigned int Z80Replayer::ExecuteTStates(unsigned int ts) {
+	unsigned int done = 0;
+
+	while (done < ts) {
+		ZQWORD now = cpu->GetClock();
+
+		if (irq_valid && irq.tstate <= now) {
+			if (irq.tstate < now) {
+				mismatches++;
+			}
+
+			switch (irq.kind) {
+				case Z80REC_INT:
+				case Z80REC_INTVEC:
+					ack[0] = irq.value;
+					ack[1] = irq.port & 0xff;
+					ack[2] = irq.port >> 8;
+					ack_pos = 0;
+					cpu->IRQ(irq.value);
+					break;
+
+				case Z80REC_NMI:
+					cpu->NMI();
+					break;
+
+				default:
+					cpu->Wait(irq.stall);
+					break;
+			}
+
+			irq_valid = Next(irq, false);
+			continue;
+		}
+
+		unsigned int slice = ts - done;
+		if (irq_valid && irq.tstate - now < slice) {
+			slice = irq.tstate - now;
+		}
+
+		unsigned int ran = cpu->ExecuteTStates(slice);
+		if (ran == 0) {
+			break;
+		}
+		done += ran;
+	}
+
+	return done;
+}
+
+
+
+// Every event of the stream has been fed
+
+bool Z80Replayer::Finished() {
+	return !in_valid && !irq_valid;
+}
+
+
+
+ZQWORD Z80Replayer::GetMismatches() {
+	return mismatches;
+}
+
+
+
+// Moves the cursor to the next IN (want_in) or to the next event of any
+// other kind. Returns false at the end of the stream.
+
+bool Z80Replayer::Next(CURSOR &cursor, bool want_in) {
+
+	while (cursor.pos < size) {
+		ZQWORD val = 0;
+		int shift = 0;
+		ZBYTE byte;
+
+		do {
+			if (cursor.pos >= size) {
+				return false;
+			}
+			byte = stream[cursor.pos++];
+			val |= (ZQWORD) (byte & 0x7f) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+
+		cursor.kind = val & 7;
+		cursor.tstate += val >> 3;
+
+		switch (cursor.kind) {
+			case Z80REC_INPORT:
+				if (cursor.pos + 2 > size) {
+					return false;
+				}
+				cursor.port = stream[cursor.pos] | (stream[cursor.pos + 1] << 8);
+				cursor.pos += 2;
+				// Falls through
+
+			case Z80REC_IN:
+			case Z80REC_INT:
+				if (cursor.pos >= size) {
+					return false;
+				}
+				cursor.value = stream[cursor.pos++];
+				break;
+
+			case Z80REC_INTVEC:
+				if (cursor.pos + 3 > size) {
+					return false;
+				}
+				cursor.value = stream[cursor.pos];
+				cursor.port = stream[cursor.pos + 1] | (stream[cursor.pos + 2] << 8);
+				cursor.pos += 3;
+				break;
+
+			case Z80REC_STALL:
+				cursor.stall = 0;
+				shift = 0;
+				do {
+					if (cursor.pos >= size) {
+						return false;
+					}
+					byte = stream[cursor.pos++];
+					cursor.stall |= (byte & 0x7f) << shift;
+					shift += 7;
+				} while (byte & 0x80);
+				break;
+
+			default:
+				break;
+		}
+
+		if ((cursor.kind == Z80REC_IN || cursor.kind == Z80REC_INPORT) == want_in) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+ZBYTE Z80Replayer::Read(ZWORD port) {
+	if (!in_valid) {
+		mismatches++;
+		return 0xff;
+	}
+
+	if (in.port != port || in.tstate != cpu->GetClock()) {
+		mismatches++;
+	}
+
+	ZBYTE value = in.value;
+	in_valid = Next(in, true);
+
+	return value;
+}
+
+
+
+// The line goes down once the recorded acceptance has happened, an IM 0
+// CALL / JP reads its address in 2 more calls
+
+ZBYTE Z80Replayer::Acknowledge() {
+	if (ack_pos == 0) {
+		cpu->ClearIRQ();
+	}
+	if (ack_pos > 2) {
+		return 0xff;
+	}
+	return ack[ack_pos++];
+}
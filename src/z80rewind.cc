@@ -0,0 +1,172 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+
+#include "z80rewind.h"
+
+
+Z80Rewind::Z80Rewind(Z80 *cpu, unsigned int capacity, unsigned int keyframe_interval) :
+	cpu(cpu), ring(std::max(capacity, 1u)) {
+
+	// The oldest checkpoint must always be a keyframe
+	this->keyframe_interval = std::max(std::min(keyframe_interval, (unsigned int) ring.size()), 1u);
+
+	current = new Z80STATE();
+	previous = new Z80STATE();
+}
+
+
+
+Z80Rewind::~Z80Rewind() {
+	delete current;
+	delete previous;
+}
+
+
+
+void Z80Rewind::Checkpoint() {
+
+	if (count == ring.size()) {
+		// Drop the oldest keyframe and the deltas that depend on it
+		do {
+			first = (first + 1) % ring.size();
+			count--;
+		} while (count && !At(0).keyframe);
+	}
+
+	ENTRY &entry = At(count);
+	entry.keyframe = count == 0 || since_keyframe >= keyframe_interval;
+	entry.index.clear();
+	entry.data.clear();
+
+	cpu->SaveState(current, false);
+	entry.clock = current->clock;
+	memcpy(entry.state, current, Z80REWIND_HEADER);
+
+	for (int page = 0; page < Z80REWIND_PAGES; page++) {
+		const ZBYTE *now = &cpu->memory[page << Z80REWIND_PAGE_BITS];
+		ZBYTE *then = &previous->memory[page << Z80REWIND_PAGE_BITS];
+
+		if (memcmp(now, then, Z80REWIND_PAGE_SIZE)) {
+			memcpy(then, now, Z80REWIND_PAGE_SIZE);
+		} else if (!entry.keyframe) {
+			continue;
+		}
+		entry.index.push_back(page);
+		entry.data.insert(entry.data.end(), now, now + Z80REWIND_PAGE_SIZE);
+	}
+
+	since_keyframe = entry.keyframe ? 1 : since_keyframe + 1;
+	count++;
+}
+
+
+
+// Returns 1 if clock is older than the oldest checkpoint
+
+int Z80Rewind::Seek(ZQWORD clock) {
+	if (count == 0 || clock < At(0).clock) {
+		return 1;
+	}
+
+	unsigned int n = count - 1;
+	while (At(n).clock > clock) {
+		n--;
+	}
+
+	Restore(n);
+
+	ZQWORD left = clock - At(n).clock;
+	while (left) {
+		unsigned int ts = (unsigned int) std::min(left, (ZQWORD) 0x10000000);
+		unsigned int ran = cpu->ExecuteTStates(ts);
+		if (ran == 0) {
+			break;		// Suspended on an IN
+		}
+		left -= std::min((ZQWORD) ran, left);
+	}
+
+	return 0;
+}
+
+
+
+void Z80Rewind::Clear() {
+	first = 0;
+	count = 0;
+	since_keyframe = 0;
+}
+
+
+
+unsigned int Z80Rewind::GetCheckpoints() {
+	return count;
+}
+
+
+
+ZQWORD Z80Rewind::GetOldest() {
+	return count ? At(0).clock : 0;
+}
+
+
+
+// Checkpoint payload, states and pages
+
+ZQWORD Z80Rewind::GetBytes() {
+	ZQWORD bytes = 0;
+
+	for (unsigned int i = 0; i < count; i++) {
+		bytes += Z80REWIND_HEADER + At(i).data.size();
+	}
+
+	return bytes;
+}
+
+
+
+Z80Rewind::ENTRY &Z80Rewind::At(unsigned int n) {
+	return ring[(first + n) % ring.size()];
+}
+
+
+
+// Rebuilds memory from the keyframe before checkpoint n and the deltas up to
+// it, loads it and makes n the newest checkpoint
+
+void Z80Rewind::Restore(unsigned int n) {
+	unsigned int key = n;
+	while (!At(key).keyframe) {
+		key--;
+	}
+
+	for (unsigned int i = key; i <= n; i++) {
+		ENTRY &entry = At(i);
+		for (unsigned int j = 0; j < entry.index.size(); j++) {
+			memcpy(&previous->memory[entry.index[j] << Z80REWIND_PAGE_BITS],
+				&entry.data[j << Z80REWIND_PAGE_BITS], Z80REWIND_PAGE_SIZE);
+		}
+	}
+	memcpy(previous, At(n).state, Z80REWIND_HEADER);
+
+	cpu->LoadState(previous);
+
+	count = n + 1;
+	since_keyframe = n - key + 1;
+}
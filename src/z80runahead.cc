@@ -0,0 +1,164 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "z80runahead.h"
+
+
+#define NS_PER_SECOND	1000000000ULL
+
+
+Z80RunAhead::Z80RunAhead(Z80 *cpu, unsigned int frame_tstates, unsigned int ahead) :
+	cpu(cpu), frame_tstates(frame_tstates), ahead(ahead), log(Z80RUNAHEAD_LOG) {
+
+	for (int port = 0; port < 256; port++) {
+		log.BufferPort(port);
+	}
+
+	state = new Z80STATE();
+	ClearStats();
+
+	FrameCallback = [](Z80 *) {};
+	PresentCallback = [](Z80 *) {};
+}
+
+
+
+Z80RunAhead::~Z80RunAhead() {
+	delete state;
+}
+
+
+
+// 0 turns run-ahead off, Frame() then presents the real frame
+
+void Z80RunAhead::SetAhead(unsigned int frames) {
+	ahead = frames;
+}
+
+
+
+void Z80RunAhead::SetFrameCallback(std::function<void(Z80 *)> cb) {
+	FrameCallback = cb;
+}
+
+
+
+// Read the output (video memory, latched ports) here, the CPU is rolled
+// back right after
+
+void Z80RunAhead::SetPresentCallback(std::function<void(Z80 *)> cb) {
+	PresentCallback = cb;
+}
+
+
+
+void Z80RunAhead::Frame() {
+	ZQWORD start = Now();
+
+	FrameCallback(cpu);
+	cpu->ExecuteTStates(frame_tstates);
+
+	ZQWORD real = Now();
+
+	stats.frames++;
+	stats.ahead = ahead;
+	stats.latency_saved = (ZQWORD) ahead * frame_tstates;
+	stats.frame_ns = real - start;
+	stats.ahead_ns = 0;
+	stats.state_ns = 0;
+
+	if (ahead == 0) {
+		PresentCallback(cpu);
+	} else {
+		cpu->SaveState(state);
+		ZQWORD saved = Now();
+
+		// Nothing outside the CPU sees the speculative frames. Only the
+		// pages they write need putting back; the real frame's dirty pages
+		// are kept aside for whoever takes them.
+		ZQWORD dirty[4];
+		memcpy(dirty, cpu->dirty, sizeof(dirty));
+		memset(cpu->dirty, 0, sizeof(cpu->dirty));
+
+		Z80Recorder *recorder = cpu->recorder;
+		Z80IRQSTATS *irqstats = cpu->irqstats;
+		Z80SharedState *shared = cpu->shared;
+		cpu->recorder = nullptr;
+		cpu->irqstats = nullptr;
+		cpu->shared = nullptr;
+
+		for (unsigned int i = 0; i < ahead; i++) {
+			FrameCallback(cpu);
+			cpu->ExecuteFrame(frame_tstates, &log);
+		}
+		ZQWORD speculated = Now();
+
+		PresentCallback(cpu);
+
+		ZQWORD presented = Now();
+		cpu->LoadState(state, false);
+		for (int word = 0; word < 4; word++) {
+			for (ZQWORD bits = cpu->dirty[word]; bits; bits &= bits - 1) {
+				unsigned int page = (word << 6) | __builtin_ctzll(bits);
+				memcpy(&cpu->memory[page << 8], &state->memory[page << 8], 256);
+			}
+			cpu->dirty[word] = dirty[word];
+		}
+		cpu->recorder = recorder;
+		cpu->irqstats = irqstats;
+		cpu->shared = shared;
+		ZQWORD loaded = Now();
+
+		stats.ahead_ns = speculated - saved;
+		stats.state_ns = (saved - real) + (loaded - presented);
+	}
+
+	stats.total_frame_ns += stats.frame_ns;
+	stats.total_ahead_ns += stats.ahead_ns;
+	stats.total_state_ns += stats.state_ns;
+}
+
+
+
+// Port writes of the last speculative frame, with their T-states
+
+const Z80IOLog &Z80RunAhead::GetAheadLog() {
+	return log;
+}
+
+
+
+const Z80RUNAHEADSTATS &Z80RunAhead::GetStats() {
+	return stats;
+}
+
+
+
+void Z80RunAhead::ClearStats() {
+	memset(&stats, 0, sizeof(stats));
+}
+
+
+
+ZQWORD Z80RunAhead::Now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ZQWORD) ts.tv_sec * NS_PER_SECOND + ts.tv_nsec;
+}
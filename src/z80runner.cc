@@ -0,0 +1,300 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+
+#include "z80runner.h"
+
+
+Z80Runner::Z80Runner(unsigned int threads) : threads(threads) {
+	if (this->threads == 0) {
+		this->threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	for (unsigned int i = 0; i < this->threads; i++) {
+		queues.push_back(new QUEUE);
+	}
+
+	queued.store(0);
+	runnable.store(0);
+	sleepers.store(0);
+	stopping.store(false);
+}
+
+
+Z80Runner::~Z80Runner() {
+	Stop();
+
+	for (auto queue : queues) {
+		delete queue;
+	}
+	for (auto job : jobs) {
+		delete job;
+	}
+}
+
+
+
+// Returns the job id. Jobs can be added before or after Start().
+
+int Z80Runner::Add(Z80 *cpu, unsigned int slice, ZQWORD cycle_quota, ZQWORD io_quota) {
+	JOB *job = new JOB;
+
+	job->cpu = cpu;
+	job->slice = std::max(slice, 1u);
+	job->cycle_quota = cycle_quota;
+	job->io_quota = io_quota;
+	job->start_clock = cpu->GetClock();
+	job->start_io = cpu->GetIOCount();
+	job->stats = Z80JOBSTATS();
+	job->stats.state = Z80JOB_QUEUED;
+
+	int id;
+	unsigned int queue;
+	{
+		std::lock_guard<std::mutex> guard(jobs_lock);
+		id = jobs.size();
+		jobs.push_back(job);
+		queue = next_queue++ % threads;
+	}
+
+	runnable++;
+	Push(queue, job);
+
+	return id;
+}
+
+
+
+void Z80Runner::Wake(int id, WAKEFUNCTION fn) {
+	JOB *job;
+	unsigned int queue;
+	{
+		std::lock_guard<std::mutex> guard(jobs_lock);
+		job = jobs[id];
+		queue = next_queue++ % threads;
+	}
+
+	std::lock_guard<std::mutex> guard(job->lock);
+
+	if (job->stats.state == Z80JOB_DONE) {
+		return;
+	}
+	if (fn) {
+		job->posted.push_back(fn);
+	}
+	if (job->stats.state == Z80JOB_PARKED) {
+		job->stats.state = Z80JOB_QUEUED;
+		runnable++;
+		Push(queue, job);
+	}
+}
+
+
+
+void Z80Runner::Start() {
+	if (!workers.empty()) {
+		return;
+	}
+
+	stopping.store(false);
+	for (unsigned int i = 0; i < threads; i++) {
+		workers.push_back(std::thread(&Z80Runner::Worker, this, i));
+	}
+}
+
+
+
+// Blocks until every job is either parked or done
+
+void Z80Runner::Wait() {
+	std::unique_lock<std::mutex> guard(idle_lock);
+	idle.wait(guard, [this]() { return runnable.load() == 0; });
+}
+
+
+
+// Workers finish their current slice and exit. Queued jobs stay queued for
+// the next Start().
+
+void Z80Runner::Stop() {
+	{
+		std::lock_guard<std::mutex> guard(idle_lock);
+		stopping.store(true);
+	}
+	work.notify_all();
+
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+}
+
+
+
+Z80JOBSTATS Z80Runner::GetStats(int id) {
+	JOB *job;
+	{
+		std::lock_guard<std::mutex> guard(jobs_lock);
+		job = jobs[id];
+	}
+
+	std::lock_guard<std::mutex> guard(job->lock);
+	return job->stats;
+}
+
+
+
+unsigned int Z80Runner::GetThreads() {
+	return threads;
+}
+
+
+
+void Z80Runner::Push(unsigned int queue, JOB *job) {
+	{
+		std::lock_guard<std::mutex> guard(queues[queue]->lock);
+		queues[queue]->jobs.push_back(job);
+	}
+
+	queued++;
+
+	if (sleepers.load() > 0) {
+		{
+			std::lock_guard<std::mutex> guard(idle_lock);
+		}
+		work.notify_one();
+	}
+}
+
+
+
+// Front of our own deque first, then the back of everybody else's
+
+Z80Runner::JOB *Z80Runner::Take(unsigned int self, bool &stolen) {
+	for (unsigned int i = 0; i < threads; i++) {
+		QUEUE *queue = queues[(self + i) % threads];
+		std::lock_guard<std::mutex> guard(queue->lock);
+
+		if (!queue->jobs.empty()) {
+			JOB *job;
+			if (i == 0) {
+				job = queue->jobs.front();
+				queue->jobs.pop_front();
+			} else {
+				job = queue->jobs.back();
+				queue->jobs.pop_back();
+			}
+			queued--;
+			stolen = i != 0;
+			return job;
+		}
+	}
+
+	return nullptr;
+}
+
+
+
+void Z80Runner::Worker(unsigned int self) {
+
+	while (!stopping.load()) {
+
+		bool stolen = false;
+		JOB *job = Take(self, stolen);
+
+		if (job == nullptr) {
+			std::unique_lock<std::mutex> guard(idle_lock);
+			sleepers++;
+			work.wait(guard, [this]() { return queued.load() > 0 || stopping.load(); });
+			sleepers--;
+			continue;
+		}
+
+		if (stolen) {
+			std::lock_guard<std::mutex> guard(job->lock);
+			job->stats.steals++;
+		}
+
+		RunSlice(job);
+
+		std::unique_lock<std::mutex> guard(job->lock);
+
+		if (job->stats.state == Z80JOB_DONE) {
+			guard.unlock();
+			Retire();
+		} else if (job->posted.empty() && job->cpu->isWaiting()) {
+			job->stats.state = Z80JOB_PARKED;
+			guard.unlock();
+			Retire();
+		} else {
+			job->stats.state = Z80JOB_QUEUED;
+			guard.unlock();
+			Push(self, job);
+		}
+	}
+}
+
+
+
+void Z80Runner::RunSlice(JOB *job) {
+	std::vector<WAKEFUNCTION> posted;
+
+	{
+		std::lock_guard<std::mutex> guard(job->lock);
+		job->stats.state = Z80JOB_RUNNING;
+		posted.swap(job->posted);
+	}
+
+	for (auto &fn : posted) {
+		fn(job->cpu);
+	}
+
+	Z80 *cpu = job->cpu;
+	ZQWORD used = cpu->GetClock() - job->start_clock;
+	unsigned int slice = job->slice;
+
+	if (job->cycle_quota && job->cycle_quota - used < slice) {
+		slice = job->cycle_quota - used;
+	}
+	if (slice) {
+		cpu->ExecuteTStates(slice);
+	}
+
+	std::lock_guard<std::mutex> guard(job->lock);
+
+	job->stats.tstates = cpu->GetClock() - job->start_clock;
+	job->stats.io = cpu->GetIOCount() - job->start_io;
+	job->stats.slices++;
+
+	if ((job->cycle_quota && job->stats.tstates >= job->cycle_quota) ||
+		(job->io_quota && job->stats.io >= job->io_quota)) {
+		job->stats.state = Z80JOB_DONE;
+	}
+}
+
+
+
+void Z80Runner::Retire() {
+	if (--runnable == 0) {
+		{
+			std::lock_guard<std::mutex> guard(idle_lock);
+		}
+		idle.notify_all();
+	}
+}
@@ -0,0 +1,163 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+
+#include "z80scheduler.h"
+
+
+static ZQWORD gcd(ZQWORD a, ZQWORD b) {
+	while (b != 0) {
+		ZQWORD t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+
+
+Z80ClockDomain::Z80ClockDomain(ZQWORD cpu_hz, ZQWORD device_hz) {
+	ZQWORD div = gcd(cpu_hz, device_hz);
+	num = cpu_hz / div;
+	den = device_hz / div;
+}
+
+
+
+// Split in quotient and remainder so ticks * num can't overflow for any
+// sane pair of frequencies
+
+ZQWORD Z80ClockDomain::ToCPU(ZQWORD ticks) const {
+	return (ticks / den) * num + ((ticks % den) * num + den - 1) / den;
+}
+
+
+
+ZQWORD Z80ClockDomain::ToDevice(ZQWORD tstates) const {
+	return (tstates / num) * den + ((tstates % num) * den) / num;
+}
+
+
+
+
+Z80Scheduler::Z80Scheduler(Z80 *cpu) : cpu(cpu) {}
+
+
+
+bool Z80Scheduler::Later(const EVENT &a, const EVENT &b) {
+	if (a.when != b.when) {
+		return a.when > b.when;
+	}
+	return a.seq > b.seq;
+}
+
+
+
+int Z80Scheduler::At(ZQWORD when, EVENTCALLBACK cb) {
+	int id = ++last_id;
+	callbacks[id] = cb;
+	heap.push_back({ when, seq++, id });
+	std::push_heap(heap.begin(), heap.end(), Later);
+	return id;
+}
+
+
+
+int Z80Scheduler::At(const Z80ClockDomain &domain, ZQWORD ticks, EVENTCALLBACK cb) {
+	return At(domain.ToCPU(ticks), cb);
+}
+
+
+
+int Z80Scheduler::In(ZQWORD tstates, EVENTCALLBACK cb) {
+	return At(cpu->GetClock() + tstates, cb);
+}
+
+
+
+// The heap entry stays until it reaches the top, Drop() skips it then
+
+void Z80Scheduler::Cancel(int id) {
+	callbacks.erase(id);
+}
+
+
+
+void Z80Scheduler::Drop() {
+	while (!heap.empty() && callbacks.find(heap.front().id) == callbacks.end()) {
+		std::pop_heap(heap.begin(), heap.end(), Later);
+		heap.pop_back();
+	}
+}
+
+
+
+ZQWORD Z80Scheduler::Next() {
+	Drop();
+	return heap.empty() ? Z80_NEVER : heap.front().when;
+}
+
+
+
+void Z80Scheduler::Fire(ZQWORD now) {
+	while (Next() <= now) {
+		EVENT ev = heap.front();
+		std::pop_heap(heap.begin(), heap.end(), Later);
+		heap.pop_back();
+
+		auto it = callbacks.find(ev.id);
+		EVENTCALLBACK cb = it->second;
+		callbacks.erase(it);
+
+		cb(ev.when);
+	}
+}
+
+
+
+// Returns the T-states run, fewer if the CPU suspends on an async IN: the
+// due events have fired, call it again once ResumeIO() has the value
+
+ZQWORD Z80Scheduler::RunUntil(ZQWORD when) {
+	ZQWORD start = cpu->GetClock();
+
+	Fire(start);
+
+	while (cpu->GetClock() < when) {
+		ZQWORD target = std::min(Next(), when);
+		ZQWORD now = cpu->GetClock();
+
+		if (target > now) {
+			ZQWORD slice = std::min(target - now, (ZQWORD) 0x7fffffff);
+			if (cpu->ExecuteTStates((unsigned int) slice) == 0) {
+				break;		// Suspended on an IN
+			}
+		}
+
+		Fire(cpu->GetClock());
+	}
+
+	return cpu->GetClock() - start;
+}
+
+
+
+ZQWORD Z80Scheduler::Run(ZQWORD tstates) {
+	return RunUntil(cpu->GetClock() + tstates);
+}
@@ -0,0 +1,262 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <thread>
+
+#include "z80shm.h"
+
+
+#define Z80SHM_SPINS	16		// Retries before Snapshot() starts yielding
+
+
+Z80SharedState::Z80SharedState() {}
+
+
+Z80SharedState::~Z80SharedState() {
+	Close();
+}
+
+
+
+int Z80SharedState::Create(const char *name) {
+
+	Close();
+
+#ifdef __linux__
+	fd = memfd_create(name, MFD_CLOEXEC);
+#else
+	char path[64];
+	snprintf(path, sizeof(path), "/z80shm.%d.%p", getpid(), (void *) this);
+	fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd >= 0) {
+		shm_unlink(path);
+	}
+	(void) name;
+#endif
+
+	if (fd < 0) {
+		return 1;
+	}
+
+	if (ftruncate(fd, sizeof(Z80SHMBLOCK)) != 0 || Map(true)) {
+		Close();
+		return 1;
+	}
+
+	owner = true;
+
+	memset(&block->regs, 0, sizeof(block->regs));
+	block->sequence.store(0, std::memory_order_relaxed);
+	block->version = Z80SHM_VERSION;
+	block->reserved = 0;
+	std::atomic_thread_fence(std::memory_order_release);
+	block->magic = Z80SHM_MAGIC;
+
+	return 0;
+}
+
+
+
+int Z80SharedState::Open(int shared_fd) {
+
+	Close();
+
+	fd = dup(shared_fd);
+	if (fd < 0) {
+		return 1;
+	}
+
+	if (Map(false) || block->magic != Z80SHM_MAGIC || block->version != Z80SHM_VERSION) {
+		Close();
+		return 1;
+	}
+
+	return 0;
+}
+
+
+
+int Z80SharedState::Open(const char *path) {
+	int shared_fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (shared_fd < 0) {
+		return 1;
+	}
+
+	int result = Open(shared_fd);
+	close(shared_fd);
+
+	return result;
+}
+
+
+
+void Z80SharedState::Close() {
+	if (attached != nullptr) {
+		Detach(attached);
+	}
+	if (block != nullptr) {
+		munmap(block, sizeof(Z80SHMBLOCK));
+		block = nullptr;
+	}
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+	owner = false;
+}
+
+
+
+int Z80SharedState::Map(bool writable) {
+	void *addr = mmap(nullptr, sizeof(Z80SHMBLOCK), writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+	if (addr == MAP_FAILED) {
+		return 1;
+	}
+	block = (Z80SHMBLOCK *) addr;
+	return 0;
+}
+
+
+
+int Z80SharedState::GetFd() {
+	return fd;
+}
+
+
+
+ZBYTE *Z80SharedState::GetMemory() {
+	return block != nullptr ? block->memory : nullptr;
+}
+
+
+
+// The CPU's memory is copied in whole, from then on only written pages
+
+void Z80SharedState::Attach(Z80 *cpu) {
+	if (!owner || cpu->memory == nullptr) {
+		return;
+	}
+	if (attached != nullptr && attached != cpu) {
+		Detach(attached);
+	}
+	attached = cpu;
+	cpu->shared = this;
+	cpu->MarkDirty(0x0000, sizeof(Z80ADDRESSBUS));
+	Publish(cpu);
+}
+
+
+
+void Z80SharedState::Detach(Z80 *cpu) {
+	if (cpu->shared == this) {
+		cpu->shared = nullptr;
+	}
+	if (attached == cpu) {
+		attached = nullptr;
+	}
+}
+
+
+
+// Seqlock write side, only ever called from the emulation thread at the end
+// of an Execute call. Copies the registers and the dirty pages, which move
+// to published for Z80::TakeDirtyPages().
+
+void Z80SharedState::Publish(Z80 *cpu) {
+	if (block == nullptr) {
+		return;
+	}
+
+	unsigned int seq = block->sequence.load(std::memory_order_relaxed);
+	block->sequence.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Z80SHMREGISTERS *regs = &block->regs;
+
+	regs->af = cpu->reg.w.af;
+	regs->bc = cpu->reg.w.bc;
+	regs->de = cpu->reg.w.de;
+	regs->hl = cpu->reg.w.hl;
+	regs->alt_af = cpu->alt_reg.w.af;
+	regs->alt_bc = cpu->alt_reg.w.bc;
+	regs->alt_de = cpu->alt_reg.w.de;
+	regs->alt_hl = cpu->alt_reg.w.hl;
+	regs->ix = cpu->reg.w.ix;
+	regs->iy = cpu->reg.w.iy;
+	regs->sp = cpu->reg.w.sp;
+	regs->pc = cpu->pc;
+	regs->ir = cpu->reg.w.ir;
+	regs->wz = cpu->reg.w.wz;
+	regs->iff1 = cpu->iff1;
+	regs->iff2 = cpu->iff2;
+	regs->im = cpu->im;
+	regs->halted = cpu->isHalted();
+
+	for (int i = 0; i < 4; i++) {
+		for (ZQWORD bits = cpu->dirty[i]; bits; bits &= bits - 1) {
+			unsigned int page = (i << 6) | __builtin_ctzll(bits);
+			memcpy(&block->memory[page << 8], &cpu->memory[page << 8], 256);
+		}
+		cpu->published[i] |= cpu->dirty[i];
+		cpu->dirty[i] = 0;
+	}
+
+	block->sequence.store(seq + 2, std::memory_order_release);
+}
+
+
+
+// Seqlock read side. Returns 1 if no consistent copy could be taken within
+// the given number of retries. Spins a little at first, then yields between
+// retries so a publisher sharing the core gets to finish.
+
+int Z80SharedState::Snapshot(Z80SHMREGISTERS *regs, ZBYTE *memory, unsigned int retries) {
+
+	if (block == nullptr) {
+		return 1;
+	}
+
+	for (unsigned int i = 0; i <= retries; i++) {
+		if (i >= Z80SHM_SPINS) {
+			std::this_thread::yield();
+		}
+
+		unsigned int before = block->sequence.load(std::memory_order_acquire);
+		if (before & 1) {
+			continue;
+		}
+
+		if (regs != nullptr) {
+			memcpy(regs, &block->regs, sizeof(Z80SHMREGISTERS));
+		}
+		if (memory != nullptr) {
+			memcpy(memory, block->memory, sizeof(Z80ADDRESSBUS));
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (block->sequence.load(std::memory_order_relaxed) == before) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
@@ -0,0 +1,739 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "z80.h"
+
+
+const ZBYTE Z80::parity[256] = {
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0,
+		1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1 };
+
+
+const ZBYTE Z80::SZ_table[256] = {
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+		0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+		0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+		0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+		0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8 };
+
+
+const ZBYTE Z80::SZP_table[256] = {
+		0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+		0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c,
+		0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+		0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08,
+		0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24,
+		0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28,
+		0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20,
+		0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c,
+		0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04,
+		0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08,
+		0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00,
+		0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c,
+		0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20,
+		0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c,
+		0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24,
+		0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28,
+		0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+		0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88,
+		0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+		0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c,
+		0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0,
+		0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac,
+		0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4,
+		0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8,
+		0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80,
+		0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c,
+		0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84,
+		0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88,
+		0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4,
+		0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8,
+		0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0,
+		0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac };
+
+
+const int Z80::V_table[4] = { 0, 4, 4, 0, };
+
+
+const Z80::OPCODES Z80::main_instructions[256] = {
+		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
+		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
+		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
+		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_ind,&Z80::DEC_ind,&Z80::LD_ind_n,&Z80::SCF,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::LD_ind_R,&Z80::HALT,&Z80::LD_ind_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_ind,&Z80::LD_R_R,
+		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_HL,&Z80::ADD_R_R,
+		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_HL,&Z80::ADC_R_R,
+		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_HL,&Z80::SUB_R,
+		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_HL,&Z80::SBC_R_R,
+		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_HL,&Z80::AND_R,
+		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_HL,&Z80::XOR_R,
+		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_HL,&Z80::OR_R,
+		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_HL,&Z80::CP_R,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
+
+
+const Z80::OPCODES Z80::cb_instructions[256] = {
+		&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_R,&Z80::RLC_HL,&Z80::RLC_R,
+		&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_R,&Z80::RRC_HL,&Z80::RRC_R,
+		&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_R,&Z80::RL_HL,&Z80::RL_R,
+		&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_R,&Z80::RR_HL,&Z80::RR_R,
+		&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_R,&Z80::SLA_HL,&Z80::SLA_R,
+		&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_R,&Z80::SRA_HL,&Z80::SRA_R,
+		&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_R,&Z80::SLL_HL,&Z80::SLL_R,
+		&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_R,&Z80::SRL_HL,&Z80::SRL_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_R,&Z80::BIT_n_HL,&Z80::BIT_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_R,&Z80::RES_n_HL,&Z80::RES_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R,
+		&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_R,&Z80::SET_n_HL,&Z80::SET_n_R };
+
+
+const Z80::OPCODES Z80::ed_instructions[256] = {
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::LD_R_R,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::LD_R_R,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::LD_R_spec,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::LD_R_spec,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::RRD,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::RLD,
+		&Z80::IN_R_c,&Z80::OUT_c_0,&Z80::SBC_RR_RR,&Z80::LD_addr_RR,&Z80::NEG,&Z80::RETN,&Z80::IM,&Z80::NOP,
+		&Z80::IN_R_c,&Z80::OUT_c_R,&Z80::ADC_RR_RR,&Z80::LD_RR_addr,&Z80::NEG,&Z80::RETI,&Z80::IM,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::LDI,&Z80::CPI,&Z80::INI,&Z80::OUTI,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::LDD,&Z80::CPD,&Z80::IND,&Z80::OUTD,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::LDIR,&Z80::CPIR,&Z80::INIR,&Z80::OTIR,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::LDDR,&Z80::CPDR,&Z80::INDR,&Z80::OTDR,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,
+		&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP,&Z80::NOP };
+
+
+const Z80::OPCODES Z80::dd_instructions[256] = {
+		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
+		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
+		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
+		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_off,&Z80::DEC_off,&Z80::LD_off_n,&Z80::SCF,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::HALT,&Z80::LD_off_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_off,&Z80::ADD_R_R,
+		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_off,&Z80::ADC_R_R,
+		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_off,&Z80::SUB_R,
+		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_off,&Z80::SBC_R_R,
+		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_off,&Z80::AND_R,
+		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_off,&Z80::XOR_R,
+		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_off,&Z80::OR_R,
+		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_off,&Z80::CP_R,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
+
+
+const Z80::OPCODES Z80::fd_instructions[256] = {
+		&Z80::NOP,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLCA,
+		&Z80::EX_RR_altRR,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRCA,
+		&Z80::DJNZ,&Z80::LD_RR_nn,&Z80::LD_ind_R,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RLA,
+		&Z80::JR_d,&Z80::ADD_RR_RR,&Z80::LD_R_ind,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::RRA,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_RR,&Z80::INC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::DAA,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_RR_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CPL,
+		&Z80::JR_cond_d,&Z80::LD_RR_nn,&Z80::LD_addr_R,&Z80::INC_RR,&Z80::INC_off,&Z80::DEC_off,&Z80::LD_off_n,&Z80::SCF,
+		&Z80::JR_cond_d,&Z80::ADD_RR_RR,&Z80::LD_R_addr,&Z80::DEC_RR,&Z80::INC_R,&Z80::DEC_R,&Z80::LD_R_n,&Z80::CCF,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::LD_off_R,&Z80::HALT,&Z80::LD_off_R,
+		&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_R,&Z80::LD_R_off,&Z80::LD_R_R,
+		&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_R,&Z80::ADD_R_off,&Z80::ADD_R_R,
+		&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_R,&Z80::ADC_R_off,&Z80::ADC_R_R,
+		&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_R,&Z80::SUB_off,&Z80::SUB_R,
+		&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_R,&Z80::SBC_R_off,&Z80::SBC_R_R,
+		&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_R,&Z80::AND_off,&Z80::AND_R,
+		&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_R,&Z80::XOR_off,&Z80::XOR_R,
+		&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_R,&Z80::OR_off,&Z80::OR_R,
+		&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_R,&Z80::CP_off,&Z80::CP_R,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::JP_nn,&Z80::CALL_cond,&Z80::PUSH,&Z80::ADD_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::RET,&Z80::JP_cond,&Z80::NOP,&Z80::CALL_cond,&Z80::CALL,&Z80::ADC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::OUT_n_R,&Z80::CALL_cond,&Z80::PUSH,&Z80::SUB_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::EXX,&Z80::JP_cond,&Z80::IN_R_n,&Z80::CALL_cond,&Z80::NOP,&Z80::SBC_R_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::EX_SP_RR,&Z80::CALL_cond,&Z80::PUSH,&Z80::AND_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::JP_ind,&Z80::JP_cond,&Z80::EX_RR_RR,&Z80::CALL_cond,&Z80::NOP,&Z80::XOR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::POP,&Z80::JP_cond,&Z80::DI,&Z80::CALL_cond,&Z80::PUSH,&Z80::OR_n,&Z80::RST,
+		&Z80::RET_cond,&Z80::LD_RR_RR,&Z80::JP_cond,&Z80::EI,&Z80::CALL_cond,&Z80::NOP,&Z80::CP_n,&Z80::RST };
+
+
+const Z80::OPCODES Z80::ddcb_instructions[256] = {
+		&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off,&Z80::RLC_off_R,
+		&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off,&Z80::RRC_off_R,
+		&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off,&Z80::RL_off_R,
+		&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off,&Z80::RR_off_R,
+		&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off,&Z80::SLA_off_R,
+		&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off,&Z80::SRA_off_R,
+		&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off,&Z80::SLL_off_R,
+		&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off,&Z80::SRL_off_R,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R };
+
+
+const Z80::OPCODES Z80::fdcb_instructions[256] = {
+		&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off_R,&Z80::RLC_off,&Z80::RLC_off_R,
+		&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off_R,&Z80::RRC_off,&Z80::RRC_off_R,
+		&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off_R,&Z80::RL_off,&Z80::RL_off_R,
+		&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off_R,&Z80::RR_off,&Z80::RR_off_R,
+		&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off_R,&Z80::SLA_off,&Z80::SLA_off_R,
+		&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off_R,&Z80::SRA_off,&Z80::SRA_off_R,
+		&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off_R,&Z80::SLL_off,&Z80::SLL_off_R,
+		&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off_R,&Z80::SRL_off,&Z80::SRL_off_R,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,&Z80::BIT_n_off,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off_R,&Z80::RES_n_off,&Z80::RES_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R,
+		&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off_R,&Z80::SET_n_off,&Z80::SET_n_off_R };
+
+const Z80::OPCODES *const Z80::instruction_tables[7] = {
+	main_instructions, cb_instructions, ed_instructions, dd_instructions,
+	fd_instructions, ddcb_instructions, fdcb_instructions
+};
+
+
+// Byte register operands index Z80REGISTERS::registers[], where each pair
+// is stored in host byte order, so the two halves swap on little endian.
+
+#ifdef _Z80_BIG_ENDIAN_
+#define HOST(n)		(n)
+#else
+#define HOST(n)		((n) ^ 1)
+#endif
+
+
+// Operands, then T-states / M-cycles taken and not taken, last M-cycle
+// T-states taken and not taken, and the kind of jump check. One set per
+// prefix: none, CB, ED, DD, FD, DDCB, FDCB.
+
+const Z80::ARGUMENT_SETS Z80::a_set[7] = {
+	{
+		{0,0,0,4,1,4,1,4,4,0},{1,0,0,10,3,10,3,2,2,0},{1,HOST(0),0,7,2,7,2,3,3,0},{1,0,0,6,2,6,2,2,2,0},{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(2),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{3,1,0,11,3,11,3,3,3,0},{HOST(0),1,0,7,2,7,2,3,3,0},{1,0,0,6,2,6,2,2,2,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,13,3,8,2,5,4,2},{2,0,0,10,3,10,3,2,2,0},{2,HOST(0),0,7,2,7,2,3,3,0},{2,0,0,6,2,6,2,2,2,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,12,3,12,3,4,4,0},{3,2,0,11,3,11,3,3,3,0},{HOST(0),2,0,7,2,7,2,3,3,0},{2,0,0,6,2,6,2,2,2,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{1,0,0,12,3,7,2,4,3,1},{3,0,0,10,3,10,3,2,2,0},{0,3,0,16,4,16,4,4,4,0},{3,0,0,6,2,6,2,2,2,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,12,3,7,2,4,3,1},{3,3,0,11,3,11,3,3,3,0},{3,0,0,16,4,16,4,4,4,0},{3,0,0,6,2,6,2,2,2,0},{HOST(7),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{3,0,0,12,3,7,2,4,3,1},{6,0,0,10,3,10,3,2,2,0},{0,HOST(0),0,13,3,13,3,5,5,0},{6,0,0,6,2,6,2,2,2,0},{3,0,0,11,3,11,3,3,3,0},{3,0,0,11,3,11,3,3,3,0},{3,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},
+		{HOST(3),0,0,12,3,7,2,4,3,1},{3,6,0,11,3,11,3,3,3,0},{HOST(0),0,0,13,3,13,3,5,5,0},{6,0,0,6,2,6,2,2,2,0},{HOST(0),0,0,4,1,4,1,4,4,0},{HOST(0),0,0,4,1,4,1,4,4,0},{HOST(0),0,0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},
+		{HOST(2),HOST(2),0,4,1,4,1,4,4,0},{HOST(2),HOST(3),0,4,1,4,1,4,4,0},{HOST(2),HOST(4),0,4,1,4,1,4,4,0},{HOST(2),HOST(5),0,4,1,4,1,4,4,0},{HOST(2),HOST(6),0,4,1,4,1,4,4,0},{HOST(2),HOST(7),0,4,1,4,1,4,4,0},{HOST(2),3,0,7,2,7,2,3,3,0},{HOST(2),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(3),HOST(2),0,4,1,4,1,4,4,0},{HOST(3),HOST(3),0,4,1,4,1,4,4,0},{HOST(3),HOST(4),0,4,1,4,1,4,4,0},{HOST(3),HOST(5),0,4,1,4,1,4,4,0},{HOST(3),HOST(6),0,4,1,4,1,4,4,0},{HOST(3),HOST(7),0,4,1,4,1,4,4,0},{HOST(3),3,0,7,2,7,2,3,3,0},{HOST(3),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(4),HOST(2),0,4,1,4,1,4,4,0},{HOST(4),HOST(3),0,4,1,4,1,4,4,0},{HOST(4),HOST(4),0,4,1,4,1,4,4,0},{HOST(4),HOST(5),0,4,1,4,1,4,4,0},{HOST(4),HOST(6),0,4,1,4,1,4,4,0},{HOST(4),HOST(7),0,4,1,4,1,4,4,0},{HOST(4),3,0,7,2,7,2,3,3,0},{HOST(4),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(5),HOST(2),0,4,1,4,1,4,4,0},{HOST(5),HOST(3),0,4,1,4,1,4,4,0},{HOST(5),HOST(4),0,4,1,4,1,4,4,0},{HOST(5),HOST(5),0,4,1,4,1,4,4,0},{HOST(5),HOST(6),0,4,1,4,1,4,4,0},{HOST(5),HOST(7),0,4,1,4,1,4,4,0},{HOST(5),3,0,7,2,7,2,3,3,0},{HOST(5),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(6),HOST(2),0,4,1,4,1,4,4,0},{HOST(6),HOST(3),0,4,1,4,1,4,4,0},{HOST(6),HOST(4),0,4,1,4,1,4,4,0},{HOST(6),HOST(5),0,4,1,4,1,4,4,0},{HOST(6),HOST(6),0,4,1,4,1,4,4,0},{HOST(6),HOST(7),0,4,1,4,1,4,4,0},{HOST(6),3,0,7,2,7,2,3,3,0},{HOST(6),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(7),HOST(2),0,4,1,4,1,4,4,0},{HOST(7),HOST(3),0,4,1,4,1,4,4,0},{HOST(7),HOST(4),0,4,1,4,1,4,4,0},{HOST(7),HOST(5),0,4,1,4,1,4,4,0},{HOST(7),HOST(6),0,4,1,4,1,4,4,0},{HOST(7),HOST(7),0,4,1,4,1,4,4,0},{HOST(7),3,0,7,2,7,2,3,3,0},{HOST(7),HOST(0),0,4,1,4,1,4,4,0},
+		{3,HOST(2),0,7,2,7,2,3,3,0},{3,HOST(3),0,7,2,7,2,3,3,0},{3,HOST(4),0,7,2,7,2,3,3,0},{3,HOST(5),0,7,2,7,2,3,3,0},{3,HOST(6),0,7,2,7,2,3,3,0},{3,HOST(7),0,7,2,7,2,3,3,0},{0,0,0,4,1,4,1,4,4,0},{3,HOST(0),0,7,2,7,2,3,3,0},
+		{HOST(0),HOST(2),0,4,1,4,1,4,4,0},{HOST(0),HOST(3),0,4,1,4,1,4,4,0},{HOST(0),HOST(4),0,4,1,4,1,4,4,0},{HOST(0),HOST(5),0,4,1,4,1,4,4,0},{HOST(0),HOST(6),0,4,1,4,1,4,4,0},{HOST(0),HOST(7),0,4,1,4,1,4,4,0},{HOST(0),3,0,7,2,7,2,3,3,0},{HOST(0),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(0),HOST(2),0,4,1,4,1,4,4,0},{HOST(0),HOST(3),0,4,1,4,1,4,4,0},{HOST(0),HOST(4),0,4,1,4,1,4,4,0},{HOST(0),HOST(5),0,4,1,4,1,4,4,0},{HOST(0),HOST(6),0,4,1,4,1,4,4,0},{HOST(0),HOST(7),0,4,1,4,1,4,4,0},{HOST(0),3,0,7,2,7,2,3,3,0},{HOST(0),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(0),HOST(2),0,4,1,4,1,4,4,0},{HOST(0),HOST(3),0,4,1,4,1,4,4,0},{HOST(0),HOST(4),0,4,1,4,1,4,4,0},{HOST(0),HOST(5),0,4,1,4,1,4,4,0},{HOST(0),HOST(6),0,4,1,4,1,4,4,0},{HOST(0),HOST(7),0,4,1,4,1,4,4,0},{HOST(0),3,0,7,2,7,2,3,3,0},{HOST(0),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{HOST(0),0,0,4,1,4,1,4,4,0},
+		{HOST(0),HOST(2),0,4,1,4,1,4,4,0},{HOST(0),HOST(3),0,4,1,4,1,4,4,0},{HOST(0),HOST(4),0,4,1,4,1,4,4,0},{HOST(0),HOST(5),0,4,1,4,1,4,4,0},{HOST(0),HOST(6),0,4,1,4,1,4,4,0},{HOST(0),HOST(7),0,4,1,4,1,4,4,0},{HOST(0),3,0,7,2,7,2,3,3,0},{HOST(0),HOST(0),0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{HOST(0),0,0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{HOST(0),0,0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{HOST(0),0,0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,4,1,4,1,4,4,0},{HOST(3),0,0,4,1,4,1,4,4,0},{HOST(4),0,0,4,1,4,1,4,4,0},{HOST(5),0,0,4,1,4,1,4,4,0},{HOST(6),0,0,4,1,4,1,4,4,0},{HOST(7),0,0,4,1,4,1,4,4,0},{3,0,0,7,2,7,2,3,3,0},{HOST(0),0,0,4,1,4,1,4,4,0},
+		{1,0,0,11,3,5,1,3,5,1},{1,0,0,10,3,10,3,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,11,3,11,3,3,3,0},{HOST(0),0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
+		{0,0,0,11,3,5,1,3,5,1},{0,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{HOST(0),0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
+		{3,0,0,11,3,5,1,3,5,1},{2,0,0,10,3,10,3,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,HOST(0),0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
+		{HOST(3),0,0,11,3,5,1,3,5,1},{0,0,0,4,1,4,1,4,4,0},{HOST(3),0,0,10,3,10,3,2,2,0},{HOST(0),0,0,11,3,11,3,3,3,0},{HOST(3),0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{HOST(0),0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
+		{7,0,0,11,3,5,1,3,5,1},{3,0,0,10,3,10,3,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,3,0,19,5,19,5,3,3,0},{7,0,0,17,4,10,3,5,2,1},{3,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
+		{6,0,0,11,3,5,1,3,5,1},{3,0,0,4,1,4,1,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
+		{5,0,0,11,3,5,1,3,5,1},{0,0,0,10,3,10,3,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,11,3,11,3,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
+		{4,0,0,11,3,5,1,3,5,1},{6,3,0,6,2,6,2,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,4,1,4,1,4,4,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
+	{
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(6),0,0,8,2,8,2,4,4,0},{HOST(7),0,0,8,2,8,2,4,4,0},{3,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{0,HOST(2),0,8,2,8,2,4,4,0},{0,HOST(3),0,8,2,8,2,4,4,0},{0,HOST(4),0,8,2,8,2,4,4,0},{0,HOST(5),0,8,2,8,2,4,4,0},{0,HOST(6),0,8,2,8,2,4,4,0},{0,HOST(7),0,8,2,8,2,4,4,0},{0,3,0,12,3,12,3,4,4,0},{0,HOST(0),0,8,2,8,2,4,4,0},
+		{1,HOST(2),0,8,2,8,2,4,4,0},{1,HOST(3),0,8,2,8,2,4,4,0},{1,HOST(4),0,8,2,8,2,4,4,0},{1,HOST(5),0,8,2,8,2,4,4,0},{1,HOST(6),0,8,2,8,2,4,4,0},{1,HOST(7),0,8,2,8,2,4,4,0},{1,3,0,12,3,12,3,4,4,0},{1,HOST(0),0,8,2,8,2,4,4,0},
+		{2,HOST(2),0,8,2,8,2,4,4,0},{2,HOST(3),0,8,2,8,2,4,4,0},{2,HOST(4),0,8,2,8,2,4,4,0},{2,HOST(5),0,8,2,8,2,4,4,0},{2,HOST(6),0,8,2,8,2,4,4,0},{2,HOST(7),0,8,2,8,2,4,4,0},{2,3,0,12,3,12,3,4,4,0},{2,HOST(0),0,8,2,8,2,4,4,0},
+		{3,HOST(2),0,8,2,8,2,4,4,0},{3,HOST(3),0,8,2,8,2,4,4,0},{3,HOST(4),0,8,2,8,2,4,4,0},{3,HOST(5),0,8,2,8,2,4,4,0},{3,HOST(6),0,8,2,8,2,4,4,0},{3,HOST(7),0,8,2,8,2,4,4,0},{3,3,0,12,3,12,3,4,4,0},{3,HOST(0),0,8,2,8,2,4,4,0},
+		{4,HOST(2),0,8,2,8,2,4,4,0},{4,HOST(3),0,8,2,8,2,4,4,0},{4,HOST(4),0,8,2,8,2,4,4,0},{4,HOST(5),0,8,2,8,2,4,4,0},{4,HOST(6),0,8,2,8,2,4,4,0},{4,HOST(7),0,8,2,8,2,4,4,0},{4,3,0,12,3,12,3,4,4,0},{4,HOST(0),0,8,2,8,2,4,4,0},
+		{5,HOST(2),0,8,2,8,2,4,4,0},{5,HOST(3),0,8,2,8,2,4,4,0},{5,HOST(4),0,8,2,8,2,4,4,0},{5,HOST(5),0,8,2,8,2,4,4,0},{5,HOST(6),0,8,2,8,2,4,4,0},{5,HOST(7),0,8,2,8,2,4,4,0},{5,3,0,12,3,12,3,4,4,0},{5,HOST(0),0,8,2,8,2,4,4,0},
+		{6,HOST(2),0,8,2,8,2,4,4,0},{6,HOST(3),0,8,2,8,2,4,4,0},{6,HOST(4),0,8,2,8,2,4,4,0},{6,HOST(5),0,8,2,8,2,4,4,0},{6,HOST(6),0,8,2,8,2,4,4,0},{6,HOST(7),0,8,2,8,2,4,4,0},{6,3,0,12,3,12,3,4,4,0},{6,HOST(0),0,8,2,8,2,4,4,0},
+		{7,HOST(2),0,8,2,8,2,4,4,0},{7,HOST(3),0,8,2,8,2,4,4,0},{7,HOST(4),0,8,2,8,2,4,4,0},{7,HOST(5),0,8,2,8,2,4,4,0},{7,HOST(6),0,8,2,8,2,4,4,0},{7,HOST(7),0,8,2,8,2,4,4,0},{7,3,0,12,3,12,3,4,4,0},{7,HOST(0),0,8,2,8,2,4,4,0},
+		{0,HOST(2),0,8,2,8,2,4,4,0},{0,HOST(3),0,8,2,8,2,4,4,0},{0,HOST(4),0,8,2,8,2,4,4,0},{0,HOST(5),0,8,2,8,2,4,4,0},{0,HOST(6),0,8,2,8,2,4,4,0},{0,HOST(7),0,8,2,8,2,4,4,0},{0,3,0,15,4,15,4,3,3,0},{0,HOST(0),0,8,2,8,2,4,4,0},
+		{1,HOST(2),0,8,2,8,2,4,4,0},{1,HOST(3),0,8,2,8,2,4,4,0},{1,HOST(4),0,8,2,8,2,4,4,0},{1,HOST(5),0,8,2,8,2,4,4,0},{1,HOST(6),0,8,2,8,2,4,4,0},{1,HOST(7),0,8,2,8,2,4,4,0},{1,3,0,15,4,15,4,3,3,0},{1,HOST(0),0,8,2,8,2,4,4,0},
+		{2,HOST(2),0,8,2,8,2,4,4,0},{2,HOST(3),0,8,2,8,2,4,4,0},{2,HOST(4),0,8,2,8,2,4,4,0},{2,HOST(5),0,8,2,8,2,4,4,0},{2,HOST(6),0,8,2,8,2,4,4,0},{2,HOST(7),0,8,2,8,2,4,4,0},{2,3,0,15,4,15,4,3,3,0},{2,HOST(0),0,8,2,8,2,4,4,0},
+		{3,HOST(2),0,8,2,8,2,4,4,0},{3,HOST(3),0,8,2,8,2,4,4,0},{3,HOST(4),0,8,2,8,2,4,4,0},{3,HOST(5),0,8,2,8,2,4,4,0},{3,HOST(6),0,8,2,8,2,4,4,0},{3,HOST(7),0,8,2,8,2,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,HOST(0),0,8,2,8,2,4,4,0},
+		{4,HOST(2),0,8,2,8,2,4,4,0},{4,HOST(3),0,8,2,8,2,4,4,0},{4,HOST(4),0,8,2,8,2,4,4,0},{4,HOST(5),0,8,2,8,2,4,4,0},{4,HOST(6),0,8,2,8,2,4,4,0},{4,HOST(7),0,8,2,8,2,4,4,0},{4,3,0,15,4,15,4,3,3,0},{4,HOST(0),0,8,2,8,2,4,4,0},
+		{5,HOST(2),0,8,2,8,2,4,4,0},{5,HOST(3),0,8,2,8,2,4,4,0},{5,HOST(4),0,8,2,8,2,4,4,0},{5,HOST(5),0,8,2,8,2,4,4,0},{5,HOST(6),0,8,2,8,2,4,4,0},{5,HOST(7),0,8,2,8,2,4,4,0},{5,3,0,15,4,15,4,3,3,0},{5,HOST(0),0,8,2,8,2,4,4,0},
+		{6,HOST(2),0,8,2,8,2,4,4,0},{6,HOST(3),0,8,2,8,2,4,4,0},{6,HOST(4),0,8,2,8,2,4,4,0},{6,HOST(5),0,8,2,8,2,4,4,0},{6,HOST(6),0,8,2,8,2,4,4,0},{6,HOST(7),0,8,2,8,2,4,4,0},{6,3,0,15,4,15,4,3,3,0},{6,HOST(0),0,8,2,8,2,4,4,0},
+		{7,HOST(2),0,8,2,8,2,4,4,0},{7,HOST(3),0,8,2,8,2,4,4,0},{7,HOST(4),0,8,2,8,2,4,4,0},{7,HOST(5),0,8,2,8,2,4,4,0},{7,HOST(6),0,8,2,8,2,4,4,0},{7,HOST(7),0,8,2,8,2,4,4,0},{7,3,0,15,4,15,4,3,3,0},{7,HOST(0),0,8,2,8,2,4,4,0},
+		{0,HOST(2),0,8,2,8,2,4,4,0},{0,HOST(3),0,8,2,8,2,4,4,0},{0,HOST(4),0,8,2,8,2,4,4,0},{0,HOST(5),0,8,2,8,2,4,4,0},{0,HOST(6),0,8,2,8,2,4,4,0},{0,HOST(7),0,8,2,8,2,4,4,0},{0,3,0,15,4,15,4,3,3,0},{0,HOST(0),0,8,2,8,2,4,4,0},
+		{1,HOST(2),0,8,2,8,2,4,4,0},{1,HOST(3),0,8,2,8,2,4,4,0},{1,HOST(4),0,8,2,8,2,4,4,0},{1,HOST(5),0,8,2,8,2,4,4,0},{1,HOST(6),0,8,2,8,2,4,4,0},{1,HOST(7),0,8,2,8,2,4,4,0},{1,3,0,15,4,15,4,3,3,0},{1,HOST(0),0,8,2,8,2,4,4,0},
+		{2,HOST(2),0,8,2,8,2,4,4,0},{2,HOST(3),0,8,2,8,2,4,4,0},{2,HOST(4),0,8,2,8,2,4,4,0},{2,HOST(5),0,8,2,8,2,4,4,0},{2,HOST(6),0,8,2,8,2,4,4,0},{2,HOST(7),0,8,2,8,2,4,4,0},{2,3,0,15,4,15,4,3,3,0},{2,HOST(0),0,8,2,8,2,4,4,0},
+		{3,HOST(2),0,8,2,8,2,4,4,0},{3,HOST(3),0,8,2,8,2,4,4,0},{3,HOST(4),0,8,2,8,2,4,4,0},{3,HOST(5),0,8,2,8,2,4,4,0},{3,HOST(6),0,8,2,8,2,4,4,0},{3,HOST(7),0,8,2,8,2,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,HOST(0),0,8,2,8,2,4,4,0},
+		{4,HOST(2),0,8,2,8,2,4,4,0},{4,HOST(3),0,8,2,8,2,4,4,0},{4,HOST(4),0,8,2,8,2,4,4,0},{4,HOST(5),0,8,2,8,2,4,4,0},{4,HOST(6),0,8,2,8,2,4,4,0},{4,HOST(7),0,8,2,8,2,4,4,0},{4,3,0,15,4,15,4,3,3,0},{4,HOST(0),0,8,2,8,2,4,4,0},
+		{5,HOST(2),0,8,2,8,2,4,4,0},{5,HOST(3),0,8,2,8,2,4,4,0},{5,HOST(4),0,8,2,8,2,4,4,0},{5,HOST(5),0,8,2,8,2,4,4,0},{5,HOST(6),0,8,2,8,2,4,4,0},{5,HOST(7),0,8,2,8,2,4,4,0},{5,3,0,15,4,15,4,3,3,0},{5,HOST(0),0,8,2,8,2,4,4,0},
+		{6,HOST(2),0,8,2,8,2,4,4,0},{6,HOST(3),0,8,2,8,2,4,4,0},{6,HOST(4),0,8,2,8,2,4,4,0},{6,HOST(5),0,8,2,8,2,4,4,0},{6,HOST(6),0,8,2,8,2,4,4,0},{6,HOST(7),0,8,2,8,2,4,4,0},{6,3,0,15,4,15,4,3,3,0},{6,HOST(0),0,8,2,8,2,4,4,0},
+		{7,HOST(2),0,8,2,8,2,4,4,0},{7,HOST(3),0,8,2,8,2,4,4,0},{7,HOST(4),0,8,2,8,2,4,4,0},{7,HOST(5),0,8,2,8,2,4,4,0},{7,HOST(6),0,8,2,8,2,4,4,0},{7,HOST(7),0,8,2,8,2,4,4,0},{7,3,0,15,4,15,4,3,3,0},{7,HOST(0),0,8,2,8,2,4,4,0} },
+	{
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{HOST(2),0,0,12,3,12,3,4,4,0},{0,HOST(2),0,12,3,12,3,4,4,0},{3,1,0,15,4,15,4,3,3,0},{0,1,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{HOST(14),HOST(0),0,9,2,9,2,5,5,0},
+		{HOST(3),0,0,12,3,12,3,4,4,0},{0,HOST(3),0,12,3,12,3,4,4,0},{3,1,0,15,4,15,4,3,3,0},{1,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{HOST(15),HOST(0),0,9,2,9,2,5,5,0},
+		{HOST(4),0,0,12,3,12,3,4,4,0},{0,HOST(4),0,12,3,12,3,4,4,0},{3,2,0,15,4,15,4,3,3,0},{0,2,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{1,0,0,8,2,8,2,4,4,0},{HOST(0),HOST(14),0,9,2,9,2,5,5,0},
+		{HOST(5),0,0,12,3,12,3,4,4,0},{0,HOST(5),0,12,3,12,3,4,4,0},{3,2,0,15,4,15,4,3,3,0},{2,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{2,0,0,8,2,8,2,4,4,0},{HOST(0),HOST(15),0,9,2,9,2,5,5,0},
+		{HOST(6),0,0,12,3,12,3,4,4,0},{0,HOST(6),0,12,3,12,3,4,4,0},{3,3,0,15,4,15,4,3,3,0},{0,3,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,18,5,18,5,2,2,0},
+		{HOST(7),0,0,12,3,12,3,4,4,0},{0,HOST(7),0,12,3,12,3,4,4,0},{3,3,0,15,4,15,4,3,3,0},{3,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,18,5,18,5,2,2,0},
+		{HOST(1),0,0,12,3,12,3,4,4,0},{0,0,0,12,3,12,3,4,4,0},{3,6,0,15,4,15,4,3,3,0},{0,6,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{1,0,0,8,2,8,2,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{HOST(0),0,0,12,3,12,3,4,4,0},{0,HOST(0),0,12,3,12,3,4,4,0},{3,6,0,15,4,15,4,3,3,0},{6,0,0,20,5,20,5,4,4,0},{0,0,0,8,2,8,2,4,4,0},{0,0,0,14,4,14,4,2,2,0},{2,0,0,8,2,8,2,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,16,4,16,4,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,21,5,16,4,5,4,3},{0,0,0,21,5,16,4,5,4,4},{0,0,0,21,5,16,4,5,4,5},{0,0,0,21,5,16,4,5,4,6},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,21,5,16,4,5,4,3},{0,0,0,21,5,16,4,5,4,4},{0,0,0,21,5,16,4,5,4,5},{0,0,0,21,5,16,4,5,4,6},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0},{0,0,0,4,1,4,1,4,4,0} },
+	{
+		{0,0,0,8,2,8,2,4,4,0},{1,0,0,14,4,14,4,2,2,0},{1,HOST(0),0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(2),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{4,1,0,15,4,15,4,3,3,0},{HOST(0),1,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,13,3,8,2,5,4,2},{2,0,0,14,4,14,4,2,2,0},{2,HOST(0),0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,12,3,12,3,4,4,0},{4,2,0,15,4,15,4,3,3,0},{HOST(0),2,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{1,0,0,12,3,7,2,4,3,1},{4,0,0,14,4,14,4,2,2,0},{0,4,0,20,5,20,5,4,4,0},{4,0,0,10,3,10,3,2,2,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,12,3,7,2,4,3,1},{4,4,0,15,4,15,4,3,3,0},{4,0,0,20,5,20,5,4,4,0},{4,0,0,10,3,10,3,2,2,0},{HOST(9),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{3,0,0,12,3,7,2,4,3,1},{6,0,0,14,4,14,4,2,2,0},{0,HOST(0),0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{HOST(3),0,0,12,3,7,2,4,3,1},{4,6,0,15,4,15,4,3,3,0},{HOST(0),0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{HOST(0),0,0,8,2,8,2,4,4,0},{HOST(0),0,0,8,2,8,2,4,4,0},{HOST(0),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{HOST(2),HOST(2),0,8,2,8,2,4,4,0},{HOST(2),HOST(3),0,8,2,8,2,4,4,0},{HOST(2),HOST(4),0,8,2,8,2,4,4,0},{HOST(2),HOST(5),0,8,2,8,2,4,4,0},{HOST(2),HOST(8),0,8,2,8,2,4,4,0},{HOST(2),HOST(9),0,8,2,8,2,4,4,0},{HOST(2),4,0,19,5,19,5,3,3,0},{HOST(2),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(3),HOST(2),0,8,2,8,2,4,4,0},{HOST(3),HOST(3),0,8,2,8,2,4,4,0},{HOST(3),HOST(4),0,8,2,8,2,4,4,0},{HOST(3),HOST(5),0,8,2,8,2,4,4,0},{HOST(3),HOST(8),0,8,2,8,2,4,4,0},{HOST(3),HOST(9),0,8,2,8,2,4,4,0},{HOST(3),4,0,19,5,19,5,3,3,0},{HOST(3),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(4),HOST(2),0,8,2,8,2,4,4,0},{HOST(4),HOST(3),0,8,2,8,2,4,4,0},{HOST(4),HOST(4),0,8,2,8,2,4,4,0},{HOST(4),HOST(5),0,8,2,8,2,4,4,0},{HOST(4),HOST(8),0,8,2,8,2,4,4,0},{HOST(4),HOST(9),0,8,2,8,2,4,4,0},{HOST(4),4,0,19,5,19,5,3,3,0},{HOST(4),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(5),HOST(2),0,8,2,8,2,4,4,0},{HOST(5),HOST(3),0,8,2,8,2,4,4,0},{HOST(5),HOST(4),0,8,2,8,2,4,4,0},{HOST(5),HOST(5),0,8,2,8,2,4,4,0},{HOST(5),HOST(8),0,8,2,8,2,4,4,0},{HOST(5),HOST(9),0,8,2,8,2,4,4,0},{HOST(5),4,0,19,5,19,5,3,3,0},{HOST(5),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(8),HOST(2),0,8,2,8,2,4,4,0},{HOST(8),HOST(3),0,8,2,8,2,4,4,0},{HOST(8),HOST(4),0,8,2,8,2,4,4,0},{HOST(8),HOST(5),0,8,2,8,2,4,4,0},{HOST(8),HOST(8),0,8,2,8,2,4,4,0},{HOST(8),HOST(9),0,8,2,8,2,4,4,0},{HOST(6),4,0,19,5,19,5,3,3,0},{HOST(8),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(9),HOST(2),0,8,2,8,2,4,4,0},{HOST(9),HOST(3),0,8,2,8,2,4,4,0},{HOST(9),HOST(4),0,8,2,8,2,4,4,0},{HOST(9),HOST(5),0,8,2,8,2,4,4,0},{HOST(9),HOST(8),0,8,2,8,2,4,4,0},{HOST(9),HOST(9),0,8,2,8,2,4,4,0},{HOST(7),4,0,19,5,19,5,3,3,0},{HOST(9),HOST(0),0,8,2,8,2,4,4,0},
+		{4,HOST(2),0,19,5,19,5,3,3,0},{4,HOST(3),0,19,5,19,5,3,3,0},{4,HOST(4),0,19,5,19,5,3,3,0},{4,HOST(5),0,19,5,19,5,3,3,0},{4,HOST(6),0,19,5,19,5,3,3,0},{4,HOST(7),0,19,5,19,5,3,3,0},{0,0,0,4,1,4,1,4,4,0},{4,HOST(0),0,19,5,19,5,3,3,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(8),0,8,2,8,2,4,4,0},{HOST(0),HOST(9),0,8,2,8,2,4,4,0},{HOST(0),4,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(8),0,8,2,8,2,4,4,0},{HOST(0),HOST(9),0,8,2,8,2,4,4,0},{HOST(0),4,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(8),0,8,2,8,2,4,4,0},{HOST(0),HOST(9),0,8,2,8,2,4,4,0},{HOST(0),4,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(8),0,8,2,8,2,4,4,0},{HOST(0),HOST(9),0,8,2,8,2,4,4,0},{HOST(0),4,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(8),0,0,8,2,8,2,4,4,0},{HOST(9),0,0,8,2,8,2,4,4,0},{4,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{1,0,0,11,3,5,1,3,5,1},{1,0,0,14,4,14,4,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
+		{0,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,8,5,8,5,1,1,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{HOST(0),0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
+		{3,0,0,11,3,5,1,3,5,1},{2,0,0,14,4,14,4,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,HOST(0),0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
+		{HOST(3),0,0,11,3,5,1,3,5,1},{0,0,0,8,2,8,2,4,4,0},{HOST(3),0,0,10,3,10,3,2,2,0},{HOST(0),0,0,11,3,11,3,3,3,0},{HOST(3),0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{HOST(0),0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
+		{7,0,0,11,3,5,1,3,5,1},{4,0,0,14,4,14,4,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,4,0,23,6,23,6,3,3,0},{7,0,0,17,4,10,3,5,2,1},{4,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
+		{6,0,0,11,3,5,1,3,5,1},{4,0,0,8,2,8,2,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
+		{5,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
+		{4,0,0,11,3,5,1,3,5,1},{6,4,0,10,3,10,3,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
+	{
+		{0,0,0,8,2,8,2,4,4,0},{1,0,0,14,4,14,4,2,2,0},{1,HOST(0),0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(2),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,4,1,4,1,4,4,0},{5,1,0,15,4,15,4,3,3,0},{HOST(0),1,0,7,2,7,2,3,3,0},{1,0,0,10,3,10,3,2,2,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,13,3,8,2,5,4,2},{2,0,0,14,4,14,4,2,2,0},{2,HOST(0),0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,12,3,12,3,4,4,0},{5,2,0,15,4,15,4,3,3,0},{HOST(0),2,0,7,2,7,2,3,3,0},{2,0,0,10,3,10,3,2,2,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{1,0,0,12,3,7,2,4,3,1},{5,0,0,14,4,14,4,2,2,0},{0,5,0,20,5,20,5,4,4,0},{5,0,0,10,3,10,3,2,2,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{0,0,0,12,3,7,2,4,3,1},{5,5,0,15,4,15,4,3,3,0},{5,0,0,20,5,20,5,4,4,0},{5,0,0,10,3,10,3,2,2,0},{HOST(11),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{3,0,0,12,3,7,2,4,3,1},{6,0,0,14,4,14,4,2,2,0},{0,HOST(0),0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,0,0,19,5,19,5,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{HOST(3),0,0,12,3,7,2,4,3,1},{5,6,0,15,4,15,4,3,3,0},{HOST(0),0,0,13,3,13,3,5,5,0},{6,0,0,10,3,10,3,2,2,0},{HOST(0),0,0,8,2,8,2,4,4,0},{HOST(0),0,0,8,2,8,2,4,4,0},{HOST(0),0,0,11,3,11,3,3,3,0},{0,0,0,8,2,8,2,4,4,0},
+		{HOST(2),HOST(2),0,8,2,8,2,4,4,0},{HOST(2),HOST(3),0,8,2,8,2,4,4,0},{HOST(2),HOST(4),0,8,2,8,2,4,4,0},{HOST(2),HOST(5),0,8,2,8,2,4,4,0},{HOST(2),HOST(10),0,8,2,8,2,4,4,0},{HOST(2),HOST(11),0,8,2,8,2,4,4,0},{HOST(2),5,0,19,5,19,5,3,3,0},{HOST(2),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(3),HOST(2),0,8,2,8,2,4,4,0},{HOST(3),HOST(3),0,8,2,8,2,4,4,0},{HOST(3),HOST(4),0,8,2,8,2,4,4,0},{HOST(3),HOST(5),0,8,2,8,2,4,4,0},{HOST(3),HOST(10),0,8,2,8,2,4,4,0},{HOST(3),HOST(11),0,8,2,8,2,4,4,0},{HOST(3),5,0,19,5,19,5,3,3,0},{HOST(3),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(4),HOST(2),0,8,2,8,2,4,4,0},{HOST(4),HOST(3),0,8,2,8,2,4,4,0},{HOST(4),HOST(4),0,8,2,8,2,4,4,0},{HOST(4),HOST(5),0,8,2,8,2,4,4,0},{HOST(4),HOST(10),0,8,2,8,2,4,4,0},{HOST(4),HOST(11),0,8,2,8,2,4,4,0},{HOST(4),5,0,19,5,19,5,3,3,0},{HOST(4),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(5),HOST(2),0,8,2,8,2,4,4,0},{HOST(5),HOST(3),0,8,2,8,2,4,4,0},{HOST(5),HOST(4),0,8,2,8,2,4,4,0},{HOST(5),HOST(5),0,8,2,8,2,4,4,0},{HOST(5),HOST(10),0,8,2,8,2,4,4,0},{HOST(5),HOST(11),0,8,2,8,2,4,4,0},{HOST(5),5,0,19,5,19,5,3,3,0},{HOST(5),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(10),HOST(2),0,8,2,8,2,4,4,0},{HOST(10),HOST(3),0,8,2,8,2,4,4,0},{HOST(10),HOST(4),0,8,2,8,2,4,4,0},{HOST(10),HOST(5),0,8,2,8,2,4,4,0},{HOST(10),HOST(10),0,8,2,8,2,4,4,0},{HOST(10),HOST(11),0,8,2,8,2,4,4,0},{HOST(6),5,0,19,5,19,5,3,3,0},{HOST(10),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(11),HOST(2),0,8,2,8,2,4,4,0},{HOST(11),HOST(3),0,8,2,8,2,4,4,0},{HOST(11),HOST(4),0,8,2,8,2,4,4,0},{HOST(11),HOST(5),0,8,2,8,2,4,4,0},{HOST(11),HOST(10),0,8,2,8,2,4,4,0},{HOST(11),HOST(11),0,8,2,8,2,4,4,0},{HOST(7),5,0,19,5,19,5,3,3,0},{HOST(11),HOST(0),0,8,2,8,2,4,4,0},
+		{5,HOST(2),0,19,5,19,5,3,3,0},{5,HOST(3),0,19,5,19,5,3,3,0},{5,HOST(4),0,19,5,19,5,3,3,0},{5,HOST(5),0,19,5,19,5,3,3,0},{5,HOST(6),0,19,5,19,5,3,3,0},{5,HOST(7),0,19,5,19,5,3,3,0},{0,0,0,4,1,4,1,4,4,0},{5,HOST(0),0,19,5,19,5,3,3,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(10),0,8,2,8,2,4,4,0},{HOST(0),HOST(11),0,8,2,8,2,4,4,0},{HOST(0),5,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(10),0,8,2,8,2,4,4,0},{HOST(0),HOST(11),0,8,2,8,2,4,4,0},{HOST(0),5,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(10),0,8,2,8,2,4,4,0},{HOST(0),HOST(11),0,8,2,8,2,4,4,0},{HOST(0),5,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(0),HOST(2),0,8,2,8,2,4,4,0},{HOST(0),HOST(3),0,8,2,8,2,4,4,0},{HOST(0),HOST(4),0,8,2,8,2,4,4,0},{HOST(0),HOST(5),0,8,2,8,2,4,4,0},{HOST(0),HOST(10),0,8,2,8,2,4,4,0},{HOST(0),HOST(11),0,8,2,8,2,4,4,0},{HOST(0),5,0,19,5,19,5,3,3,0},{HOST(0),HOST(0),0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{HOST(2),0,0,8,2,8,2,4,4,0},{HOST(3),0,0,8,2,8,2,4,4,0},{HOST(4),0,0,8,2,8,2,4,4,0},{HOST(5),0,0,8,2,8,2,4,4,0},{HOST(10),0,0,8,2,8,2,4,4,0},{HOST(11),0,0,8,2,8,2,4,4,0},{5,0,0,19,5,19,5,3,3,0},{HOST(0),0,0,8,2,8,2,4,4,0},
+		{1,0,0,11,3,5,1,3,5,1},{1,0,0,14,4,14,4,2,2,0},{1,0,0,10,3,10,3,2,2,0},{0,0,0,10,3,10,3,2,2,0},{1,0,0,17,4,10,3,5,2,1},{1,0,0,15,4,15,4,3,3,0},{HOST(0),0,0,7,2,7,2,3,3,0},{0,0,0,11,3,11,3,3,3,0},
+		{0,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{0,0,0,10,3,10,3,2,2,0},{0,0,0,8,5,8,5,1,1,0},{0,0,0,17,4,10,3,5,2,1},{0,0,0,17,4,17,4,5,5,0},{HOST(0),0,0,7,2,7,2,3,3,0},{8,0,0,11,3,11,3,3,3,0},
+		{3,0,0,11,3,5,1,3,5,1},{2,0,0,14,4,14,4,2,2,0},{3,0,0,10,3,10,3,2,2,0},{0,HOST(0),0,11,3,11,3,3,3,0},{3,0,0,17,4,10,3,5,2,1},{2,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{16,0,0,11,3,11,3,3,3,0},
+		{HOST(3),0,0,11,3,5,1,3,5,1},{0,0,0,8,2,8,2,4,4,0},{HOST(3),0,0,10,3,10,3,2,2,0},{HOST(0),0,0,11,3,11,3,3,3,0},{HOST(3),0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{HOST(0),0,0,7,2,7,2,3,3,0},{24,0,0,11,3,11,3,3,3,0},
+		{7,0,0,11,3,5,1,3,5,1},{5,0,0,14,4,14,4,2,2,0},{7,0,0,10,3,10,3,2,2,0},{6,5,0,23,6,23,6,3,3,0},{7,0,0,17,4,10,3,5,2,1},{5,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{32,0,0,11,3,11,3,3,3,0},
+		{6,0,0,11,3,5,1,3,5,1},{5,0,0,8,2,8,2,4,4,0},{6,0,0,10,3,10,3,2,2,0},{2,3,0,4,1,4,1,4,4,0},{6,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{40,0,0,11,3,11,3,3,3,0},
+		{5,0,0,11,3,5,1,3,5,1},{0,0,0,14,4,14,4,2,2,0},{5,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{5,0,0,17,4,10,3,5,2,1},{0,0,0,15,4,15,4,3,3,0},{0,0,0,7,2,7,2,3,3,0},{48,0,0,11,3,11,3,3,3,0},
+		{4,0,0,11,3,5,1,3,5,1},{6,5,0,10,3,10,3,2,2,0},{4,0,0,10,3,10,3,2,2,0},{0,0,0,4,1,4,1,4,4,0},{4,0,0,17,4,10,3,5,2,1},{0,0,0,8,5,8,5,1,1,0},{0,0,0,7,2,7,2,3,3,0},{56,0,0,11,3,11,3,3,3,0} },
+	{
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{4,HOST(2),0,23,6,23,6,3,3,0},{4,HOST(3),0,23,6,23,6,3,3,0},{4,HOST(4),0,23,6,23,6,3,3,0},{4,HOST(5),0,23,6,23,6,3,3,0},{4,HOST(6),0,23,6,23,6,3,3,0},{4,HOST(7),0,23,6,23,6,3,3,0},{4,0,0,23,6,23,6,3,3,0},{4,HOST(0),0,23,6,23,6,3,3,0},
+		{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},{0,4,0,20,5,20,5,4,4,0},
+		{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},{1,4,0,20,5,20,5,4,4,0},
+		{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},{2,4,0,20,5,20,5,4,4,0},
+		{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},{3,4,0,20,5,20,5,4,4,0},
+		{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},{4,4,0,20,5,20,5,4,4,0},
+		{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},{5,4,0,20,5,20,5,4,4,0},
+		{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},{6,4,0,20,5,20,5,4,4,0},
+		{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},{7,4,0,20,5,20,5,4,4,0},
+		{0,4,HOST(2),23,6,23,6,3,3,0},{0,4,HOST(3),23,6,23,6,3,3,0},{0,4,HOST(4),23,6,23,6,3,3,0},{0,4,HOST(5),23,6,23,6,3,3,0},{0,4,HOST(6),23,6,23,6,3,3,0},{0,4,HOST(7),23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},{0,4,HOST(0),23,6,23,6,3,3,0},
+		{1,4,HOST(2),23,6,23,6,3,3,0},{1,4,HOST(3),23,6,23,6,3,3,0},{1,4,HOST(4),23,6,23,6,3,3,0},{1,4,HOST(5),23,6,23,6,3,3,0},{1,4,HOST(6),23,6,23,6,3,3,0},{1,4,HOST(7),23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},{1,4,HOST(0),23,6,23,6,3,3,0},
+		{2,4,HOST(2),23,6,23,6,3,3,0},{2,4,HOST(3),23,6,23,6,3,3,0},{2,4,HOST(4),23,6,23,6,3,3,0},{2,4,HOST(5),23,6,23,6,3,3,0},{2,4,HOST(6),23,6,23,6,3,3,0},{2,4,HOST(7),23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},{2,4,HOST(0),23,6,23,6,3,3,0},
+		{3,4,HOST(2),23,6,23,6,3,3,0},{3,4,HOST(3),23,6,23,6,3,3,0},{3,4,HOST(4),23,6,23,6,3,3,0},{3,4,HOST(5),23,6,23,6,3,3,0},{3,4,HOST(6),23,6,23,6,3,3,0},{3,4,HOST(7),23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},{3,4,HOST(0),23,6,23,6,3,3,0},
+		{4,4,HOST(2),23,6,23,6,3,3,0},{4,4,HOST(3),23,6,23,6,3,3,0},{4,4,HOST(4),23,6,23,6,3,3,0},{4,4,HOST(5),23,6,23,6,3,3,0},{4,4,HOST(6),23,6,23,6,3,3,0},{4,4,HOST(7),23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,4,HOST(0),23,6,23,6,3,3,0},
+		{5,4,HOST(2),23,6,23,6,3,3,0},{5,4,HOST(3),23,6,23,6,3,3,0},{5,4,HOST(4),23,6,23,6,3,3,0},{5,4,HOST(5),23,6,23,6,3,3,0},{5,4,HOST(6),23,6,23,6,3,3,0},{5,4,HOST(7),23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,4,HOST(0),23,6,23,6,3,3,0},
+		{6,4,HOST(2),23,6,23,6,3,3,0},{6,4,HOST(3),23,6,23,6,3,3,0},{6,4,HOST(4),23,6,23,6,3,3,0},{6,4,HOST(5),23,6,23,6,3,3,0},{6,4,HOST(6),23,6,23,6,3,3,0},{6,4,HOST(7),23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},{6,4,HOST(0),23,6,23,6,3,3,0},
+		{7,4,HOST(2),23,6,23,6,3,3,0},{7,4,HOST(3),23,6,23,6,3,3,0},{7,4,HOST(4),23,6,23,6,3,3,0},{7,4,HOST(5),23,6,23,6,3,3,0},{7,4,HOST(6),23,6,23,6,3,3,0},{7,4,HOST(7),23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0},{7,4,HOST(0),23,6,23,6,3,3,0},
+		{0,4,HOST(2),23,6,23,6,3,3,0},{0,4,HOST(3),23,6,23,6,3,3,0},{0,4,HOST(4),23,6,23,6,3,3,0},{0,4,HOST(5),23,6,23,6,3,3,0},{0,4,HOST(6),23,6,23,6,3,3,0},{0,4,HOST(7),23,6,23,6,3,3,0},{0,4,0,23,6,23,6,3,3,0},{0,4,HOST(0),23,6,23,6,3,3,0},
+		{1,4,HOST(2),23,6,23,6,3,3,0},{1,4,HOST(3),23,6,23,6,3,3,0},{1,4,HOST(4),23,6,23,6,3,3,0},{1,4,HOST(5),23,6,23,6,3,3,0},{1,4,HOST(6),23,6,23,6,3,3,0},{1,4,HOST(7),23,6,23,6,3,3,0},{1,4,0,23,6,23,6,3,3,0},{1,4,HOST(0),23,6,23,6,3,3,0},
+		{2,4,HOST(2),23,6,23,6,3,3,0},{2,4,HOST(3),23,6,23,6,3,3,0},{2,4,HOST(4),23,6,23,6,3,3,0},{2,4,HOST(5),23,6,23,6,3,3,0},{2,4,HOST(6),23,6,23,6,3,3,0},{2,4,HOST(7),23,6,23,6,3,3,0},{2,4,0,23,6,23,6,3,3,0},{2,4,HOST(0),23,6,23,6,3,3,0},
+		{3,4,HOST(2),23,6,23,6,3,3,0},{3,4,HOST(3),23,6,23,6,3,3,0},{3,4,HOST(4),23,6,23,6,3,3,0},{3,4,HOST(5),23,6,23,6,3,3,0},{3,4,HOST(6),23,6,23,6,3,3,0},{3,4,HOST(7),23,6,23,6,3,3,0},{3,4,0,23,6,23,6,3,3,0},{3,4,HOST(0),23,6,23,6,3,3,0},
+		{4,4,HOST(2),23,6,23,6,3,3,0},{4,4,HOST(3),23,6,23,6,3,3,0},{4,4,HOST(4),23,6,23,6,3,3,0},{4,4,HOST(5),23,6,23,6,3,3,0},{4,4,HOST(6),23,6,23,6,3,3,0},{4,4,HOST(7),23,6,23,6,3,3,0},{4,4,0,23,6,23,6,3,3,0},{4,4,HOST(0),23,6,23,6,3,3,0},
+		{5,4,HOST(2),23,6,23,6,3,3,0},{5,4,HOST(3),23,6,23,6,3,3,0},{5,4,HOST(4),23,6,23,6,3,3,0},{5,4,HOST(5),23,6,23,6,3,3,0},{5,4,HOST(6),23,6,23,6,3,3,0},{5,4,HOST(7),23,6,23,6,3,3,0},{5,4,0,23,6,23,6,3,3,0},{5,4,HOST(0),23,6,23,6,3,3,0},
+		{6,4,HOST(2),23,6,23,6,3,3,0},{6,4,HOST(3),23,6,23,6,3,3,0},{6,4,HOST(4),23,6,23,6,3,3,0},{6,4,HOST(5),23,6,23,6,3,3,0},{6,4,HOST(6),23,6,23,6,3,3,0},{6,4,HOST(7),23,6,23,6,3,3,0},{6,4,0,23,6,23,6,3,3,0},{6,4,HOST(0),23,6,23,6,3,3,0},
+		{7,4,HOST(2),23,6,23,6,3,3,0},{7,4,HOST(3),23,6,23,6,3,3,0},{7,4,HOST(4),23,6,23,6,3,3,0},{7,4,HOST(5),23,6,23,6,3,3,0},{7,4,HOST(6),23,6,23,6,3,3,0},{7,4,HOST(7),23,6,23,6,3,3,0},{7,4,0,23,6,23,6,3,3,0},{7,4,HOST(0),23,6,23,6,3,3,0} },
+	{
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{5,HOST(2),0,23,6,23,6,3,3,0},{5,HOST(3),0,23,6,23,6,3,3,0},{5,HOST(4),0,23,6,23,6,3,3,0},{5,HOST(5),0,23,6,23,6,3,3,0},{5,HOST(6),0,23,6,23,6,3,3,0},{5,HOST(7),0,23,6,23,6,3,3,0},{5,0,0,23,6,23,6,3,3,0},{5,HOST(0),0,23,6,23,6,3,3,0},
+		{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},{0,5,0,20,5,20,5,4,4,0},
+		{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},{1,5,0,20,5,20,5,4,4,0},
+		{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},{2,5,0,20,5,20,5,4,4,0},
+		{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},{3,5,0,20,5,20,5,4,4,0},
+		{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},{4,5,0,20,5,20,5,4,4,0},
+		{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},{5,5,0,20,5,20,5,4,4,0},
+		{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},{6,5,0,20,5,20,5,4,4,0},
+		{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},{7,5,0,20,5,20,5,4,4,0},
+		{0,5,HOST(2),23,6,23,6,3,3,0},{0,5,HOST(3),23,6,23,6,3,3,0},{0,5,HOST(4),23,6,23,6,3,3,0},{0,5,HOST(5),23,6,23,6,3,3,0},{0,5,HOST(6),23,6,23,6,3,3,0},{0,5,HOST(7),23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},{0,5,HOST(0),23,6,23,6,3,3,0},
+		{1,5,HOST(2),23,6,23,6,3,3,0},{1,5,HOST(3),23,6,23,6,3,3,0},{1,5,HOST(4),23,6,23,6,3,3,0},{1,5,HOST(5),23,6,23,6,3,3,0},{1,5,HOST(6),23,6,23,6,3,3,0},{1,5,HOST(7),23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},{1,5,HOST(0),23,6,23,6,3,3,0},
+		{2,5,HOST(2),23,6,23,6,3,3,0},{2,5,HOST(3),23,6,23,6,3,3,0},{2,5,HOST(4),23,6,23,6,3,3,0},{2,5,HOST(5),23,6,23,6,3,3,0},{2,5,HOST(6),23,6,23,6,3,3,0},{2,5,HOST(7),23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},{2,5,HOST(0),23,6,23,6,3,3,0},
+		{3,5,HOST(2),23,6,23,6,3,3,0},{3,5,HOST(3),23,6,23,6,3,3,0},{3,5,HOST(4),23,6,23,6,3,3,0},{3,5,HOST(5),23,6,23,6,3,3,0},{3,5,HOST(6),23,6,23,6,3,3,0},{3,5,HOST(7),23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},{3,5,HOST(0),23,6,23,6,3,3,0},
+		{4,5,HOST(2),23,6,23,6,3,3,0},{4,5,HOST(3),23,6,23,6,3,3,0},{4,5,HOST(4),23,6,23,6,3,3,0},{4,5,HOST(5),23,6,23,6,3,3,0},{4,5,HOST(6),23,6,23,6,3,3,0},{4,5,HOST(7),23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,5,HOST(0),23,6,23,6,3,3,0},
+		{5,5,HOST(2),23,6,23,6,3,3,0},{5,5,HOST(3),23,6,23,6,3,3,0},{5,5,HOST(4),23,6,23,6,3,3,0},{5,5,HOST(5),23,6,23,6,3,3,0},{5,5,HOST(6),23,6,23,6,3,3,0},{5,5,HOST(7),23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,5,HOST(0),23,6,23,6,3,3,0},
+		{6,5,HOST(2),23,6,23,6,3,3,0},{6,5,HOST(3),23,6,23,6,3,3,0},{6,5,HOST(4),23,6,23,6,3,3,0},{6,5,HOST(5),23,6,23,6,3,3,0},{6,5,HOST(6),23,6,23,6,3,3,0},{6,5,HOST(7),23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},{6,5,HOST(0),23,6,23,6,3,3,0},
+		{7,5,HOST(2),23,6,23,6,3,3,0},{7,5,HOST(3),23,6,23,6,3,3,0},{7,5,HOST(4),23,6,23,6,3,3,0},{7,5,HOST(5),23,6,23,6,3,3,0},{7,5,HOST(6),23,6,23,6,3,3,0},{7,5,HOST(7),23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0},{7,5,HOST(0),23,6,23,6,3,3,0},
+		{0,5,HOST(2),23,6,23,6,3,3,0},{0,5,HOST(3),23,6,23,6,3,3,0},{0,5,HOST(4),23,6,23,6,3,3,0},{0,5,HOST(5),23,6,23,6,3,3,0},{0,5,HOST(6),23,6,23,6,3,3,0},{0,5,HOST(7),23,6,23,6,3,3,0},{0,5,0,23,6,23,6,3,3,0},{0,5,HOST(0),23,6,23,6,3,3,0},
+		{1,5,HOST(2),23,6,23,6,3,3,0},{1,5,HOST(3),23,6,23,6,3,3,0},{1,5,HOST(4),23,6,23,6,3,3,0},{1,5,HOST(5),23,6,23,6,3,3,0},{1,5,HOST(6),23,6,23,6,3,3,0},{1,5,HOST(7),23,6,23,6,3,3,0},{1,5,0,23,6,23,6,3,3,0},{1,5,HOST(0),23,6,23,6,3,3,0},
+		{2,5,HOST(2),23,6,23,6,3,3,0},{2,5,HOST(3),23,6,23,6,3,3,0},{2,5,HOST(4),23,6,23,6,3,3,0},{2,5,HOST(5),23,6,23,6,3,3,0},{2,5,HOST(6),23,6,23,6,3,3,0},{2,5,HOST(7),23,6,23,6,3,3,0},{2,5,0,23,6,23,6,3,3,0},{2,5,HOST(0),23,6,23,6,3,3,0},
+		{3,5,HOST(2),23,6,23,6,3,3,0},{3,5,HOST(3),23,6,23,6,3,3,0},{3,5,HOST(4),23,6,23,6,3,3,0},{3,5,HOST(5),23,6,23,6,3,3,0},{3,5,HOST(6),23,6,23,6,3,3,0},{3,5,HOST(7),23,6,23,6,3,3,0},{3,5,0,23,6,23,6,3,3,0},{3,5,HOST(0),23,6,23,6,3,3,0},
+		{4,5,HOST(2),23,6,23,6,3,3,0},{4,5,HOST(3),23,6,23,6,3,3,0},{4,5,HOST(4),23,6,23,6,3,3,0},{4,5,HOST(5),23,6,23,6,3,3,0},{4,5,HOST(6),23,6,23,6,3,3,0},{4,5,HOST(7),23,6,23,6,3,3,0},{4,5,0,23,6,23,6,3,3,0},{4,5,HOST(0),23,6,23,6,3,3,0},
+		{5,5,HOST(2),23,6,23,6,3,3,0},{5,5,HOST(3),23,6,23,6,3,3,0},{5,5,HOST(4),23,6,23,6,3,3,0},{5,5,HOST(5),23,6,23,6,3,3,0},{5,5,HOST(6),23,6,23,6,3,3,0},{5,5,HOST(7),23,6,23,6,3,3,0},{5,5,0,23,6,23,6,3,3,0},{5,5,HOST(0),23,6,23,6,3,3,0},
+		{6,5,HOST(2),23,6,23,6,3,3,0},{6,5,HOST(3),23,6,23,6,3,3,0},{6,5,HOST(4),23,6,23,6,3,3,0},{6,5,HOST(5),23,6,23,6,3,3,0},{6,5,HOST(6),23,6,23,6,3,3,0},{6,5,HOST(7),23,6,23,6,3,3,0},{6,5,0,23,6,23,6,3,3,0},{6,5,HOST(0),23,6,23,6,3,3,0},
+		{7,5,HOST(2),23,6,23,6,3,3,0},{7,5,HOST(3),23,6,23,6,3,3,0},{7,5,HOST(4),23,6,23,6,3,3,0},{7,5,HOST(5),23,6,23,6,3,3,0},{7,5,HOST(6),23,6,23,6,3,3,0},{7,5,HOST(7),23,6,23,6,3,3,0},{7,5,0,23,6,23,6,3,3,0},{7,5,HOST(0),23,6,23,6,3,3,0} } };
+
+#undef HOST
+
+
+
+// Internal T-states before each bus access of an instruction body, one nibble
+// per access from the low one, see util/tables.py
+#ifdef __Z80BUSTIMING__
+
+const ZWORD Z80::bus_gap_table[7][256] = {
+	{
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0010,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0100,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0100,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001 },
+	{
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000 },
+	{
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0040,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0040,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000 },
+	{
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0150,0x0150,0x0200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0050,0x0050,0x0050,0x0050,0x0050,0x0050,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0100,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0100,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001 },
+	{
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0150,0x0150,0x0200,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0050,0x0050,0x0050,0x0050,0x0050,0x0050,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0050,0x0000,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0100,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0100,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001,
+		0x0001,0x0000,0x0000,0x0000,0x0100,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0001 },
+	{
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012 },
+	{
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,
+		0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012,0x0012 } };
+
+#endif
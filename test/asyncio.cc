@@ -0,0 +1,159 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+
+
+// Asynchronous INs against synchronous ones. Every IN form, plain and behind
+// DD / FD prefixes (stray ones included), runs on a CPU reading its ports
+// directly and on one that suspends on every IN and is resumed with the same
+// value. After every instruction both must hold the same registers, R, clock
+// and memory.
+// asyncio [instructions]
+
+
+#define ASYNC_STEPS		20000
+
+
+static Z80ADDRESSBUS sync_memory, async_memory;
+static Z80 sync_cpu, async_cpu;
+static Z80STATE sync_state, async_state;
+static unsigned int sync_reads = 0;
+static unsigned int async_reads = 0;
+static ZWORD pending_port;
+static unsigned int suspends = 0;
+
+
+
+// What the device returns for the nth IN from a port
+
+static ZBYTE Value(ZWORD port, unsigned int n) {
+	return (ZBYTE) (port * 31 + (port >> 8) + n * 7);
+}
+
+
+
+static ZBYTE SyncRead(ZWORD port) {
+	return Value(port, sync_reads++);
+}
+
+
+
+static bool AsyncRead(ZWORD port, ZBYTE &) {
+	pending_port = port;
+	suspends++;
+	return false;
+}
+
+
+
+static void Out(ZWORD, ZBYTE) {
+}
+
+
+
+static void Setup(Z80 *cpu, ZBYTE *memory) {
+	static const ZBYTE code[] = {
+		0xdb, 0x10,					// IN A, (10)
+		0xed, 0x78,					// IN A, (C)
+		0xed, 0x40,					// IN B, (C)
+		0xdd, 0xdb, 0x11,			// IN A, (11) behind DD
+		0xfd, 0xdb, 0x12,			// IN A, (12) behind FD
+		0xdd, 0xed, 0x78,			// Stray DD, IN A, (C)
+		0xfd, 0xfd, 0xed, 0x50,		// Two stray FDs, IN D, (C)
+		0xfd, 0xed, 0xa2,			// Stray FD, INI
+		0xed, 0xaa,					// IND
+		0x06, 0x05,					// LD B, 5
+		0xed, 0xb2,					// INIR
+		0x06, 0x03,					// LD B, 3
+		0xdd, 0xed, 0xba,			// Stray DD, INDR
+		0x0c,						// INC C
+		0x18, 0xdc,					// JR to the start
+	};
+
+	memset(memory, 0, sizeof(Z80ADDRESSBUS));
+	memcpy(memory, code, sizeof(code));
+
+	cpu->memory = memory;
+	cpu->SetIOWriteCallback(Out);
+	cpu->Reset();
+
+	Z80STATE state;
+	cpu->SaveState(&state, false);
+	state.pc = 0x0000;
+	state.sp = 0x8000;
+	state.hl = 0x4000;
+	state.bc = 0x20fe;
+	cpu->LoadState(&state, false);
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int steps = argc > 1 ? atoi(argv[1]) : ASYNC_STEPS;
+
+	Setup(&sync_cpu, sync_memory);
+	sync_cpu.SetIOReadCallback(SyncRead);
+
+	Setup(&async_cpu, async_memory);
+	async_cpu.SetIOReadAsyncCallback(AsyncRead);
+
+	int failed = 0;
+
+	for (int i = 0; i < steps && failed < 10; i++) {
+		sync_cpu.ExecuteInstruction();
+
+		ZQWORD before = async_cpu.GetClock();
+		async_cpu.ExecuteInstruction();
+		if (async_cpu.isSuspended()) {
+			if (async_cpu.GetClock() != before) {
+				printf("Step %d: time passed while suspending\n", i);
+				failed++;
+			}
+			async_cpu.ResumeIO(Value(pending_port, async_reads++));
+			async_cpu.ExecuteInstruction();
+		}
+
+		sync_cpu.SaveState(&sync_state, false);
+		async_cpu.SaveState(&async_state, false);
+
+		if (sync_state.pc != async_state.pc || sync_state.sp != async_state.sp ||
+			sync_state.af != async_state.af || sync_state.bc != async_state.bc ||
+			sync_state.de != async_state.de || sync_state.hl != async_state.hl ||
+			sync_state.ix != async_state.ix || sync_state.iy != async_state.iy ||
+			sync_state.ir != async_state.ir || sync_state.wz != async_state.wz ||
+			sync_state.clock != async_state.clock || memcmp(sync_memory, async_memory, sizeof(sync_memory))) {
+			printf("Step %d: sync pc %04x ir %04x clock %llu, async pc %04x ir %04x clock %llu\n", i,
+				sync_state.pc, sync_state.ir, sync_state.clock, async_state.pc, async_state.ir, async_state.clock);
+			failed++;
+		}
+	}
+
+	if (suspends != sync_reads || async_reads != sync_reads) {
+		printf("%u INs, %u suspended, %u resumed\n", sync_reads, suspends, async_reads);
+		failed++;
+	}
+
+	printf("%u INS\n", sync_reads);
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80batch.h"
+#include "zexfixture.h"
+
+
+// Z80Batch on zexdoc, every lane started a different number of instructions
+// in so they sit at different PCs. SelfTest() checks the lanes against the
+// scalar core, then each lane is checked against a core that ran on its own
+// from the state the lane was loaded with. One lane starts with a WAIT
+// pending and another with an IM 2 request, which only the carried stall
+// and bus byte get right.
+// batchtest [program.com] [steps]
+
+
+#define BATCH_LANES		16
+#define BATCH_STEPS		200000
+#define BATCH_SKEW		997			// Instructions run before loading, times the lane
+#define BATCH_STALL		7
+#define BATCH_VECTOR	0x40		// IM 2 vector at FE40, to the RET at 0005
+
+
+static Z80ADDRESSBUS program;
+static Z80ADDRESSBUS memory[BATCH_LANES];
+static Z80 cores[BATCH_LANES];
+static Z80STATE mine, theirs;
+static Z80Batch batch(BATCH_LANES);
+
+
+
+static ZBYTE In(ZWORD) {
+	return 0xff;
+}
+
+
+
+static void Out(ZWORD, ZBYTE) {
+}
+
+
+
+static ZBYTE LaneIn(unsigned int, ZWORD) {
+	return 0xff;
+}
+
+
+
+static void LaneOut(unsigned int, ZWORD, ZBYTE) {
+}
+
+
+
+static int Load(const char *filename) {
+	if (!LoadZex(filename, program)) {
+		return 1;
+	}
+	program[0xfe40] = 0x05;
+	program[0xfe41] = 0x00;
+
+	return 0;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	const char *filename = argc > 1 ? argv[1] : "./test/zexdoc.com";
+	unsigned int steps = argc > 2 ? atoi(argv[2]) : BATCH_STEPS;
+
+	if (Load(filename)) {
+		return 1;
+	}
+
+	batch.SetIOReadCallback(LaneIn);
+	batch.SetIOWriteCallback(LaneOut);
+
+	for (unsigned int n = 0; n < BATCH_LANES; n++) {
+		Z80 *cpu = &cores[n];
+		memcpy(memory[n], program, sizeof(program));
+		cpu->memory = memory[n];
+		cpu->SetIOReadCallback(In);
+		cpu->SetIOWriteCallback(Out);
+		cpu->Reset();
+		for (unsigned int s = 0; s < n * BATCH_SKEW; s++) {
+			cpu->ExecuteInstruction();
+		}
+
+		if (n == 1) {
+			cpu->Wait(BATCH_STALL);
+		} else if (n == 2) {
+			cpu->SaveState(&theirs, false);
+			theirs.ir = 0xfe00 | (theirs.ir & 0xff);
+			theirs.iff1 = theirs.iff2 = 1;
+			theirs.im = 2;
+			cpu->LoadState(&theirs, false);
+			cpu->IRQ(BATCH_VECTOR);
+		}
+
+		batch.Load(n, cpu);
+		memcpy(batch.GetMemory(n), memory[n], sizeof(memory[n]));
+	}
+
+	int failed = 0;
+
+	int lane = batch.SelfTest(steps);
+	if (lane >= 0) {
+		printf("Lane %d disagrees with the scalar core\n", lane);
+		failed++;
+	}
+
+	Z80 lane_cpu;
+	for (unsigned int n = 0; n < BATCH_LANES; n++) {
+		for (unsigned int s = 0; s < steps; s++) {
+			cores[n].ExecuteInstruction();
+		}
+		cores[n].SaveState(&theirs, false);
+
+		lane_cpu.memory = batch.GetMemory(n);
+		batch.Store(n, &lane_cpu);
+		lane_cpu.SaveState(&mine, false);
+
+		if (mine.pc != theirs.pc || mine.sp != theirs.sp || mine.af != theirs.af || mine.bc != theirs.bc ||
+			mine.de != theirs.de || mine.hl != theirs.hl || mine.ix != theirs.ix || mine.iy != theirs.iy ||
+			mine.iff1 != theirs.iff1 || mine.clock != theirs.clock ||
+			memcmp(batch.GetMemory(n), memory[n], sizeof(memory[n]))) {
+			printf("Lane %u (pc %04x, clock %llu) diverged from its own core (pc %04x, clock %llu)\n", n,
+				mine.pc, mine.clock, theirs.pc, theirs.clock);
+			failed++;
+		}
+	}
+
+	printf("%u LANES, %llu vectorized, %llu scalar\n", (unsigned int) BATCH_LANES,
+		(unsigned long long) batch.GetVectorized(), (unsigned long long) batch.GetScalar());
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
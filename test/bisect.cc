@@ -0,0 +1,143 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80batch.h"
+#include "z80bisect.h"
+#include "zexfixture.h"
+
+
+// Z80Bisect on zexdoc. The scalar core against a Z80Batch lane must agree
+// all the way; against a core that corrupts memory once past a given
+// T-state, it must stop exactly at the instruction that crossed it and show
+// the diff.
+// bisect [program.com] [instructions]
+
+
+#define BISECT_STEPS		3000000
+#define BISECT_FAULT		1234567		// T-state
+#define BISECT_ADDRESS		0xc000
+
+
+static Z80ADDRESSBUS memory_a, memory_b, memory_shadow;
+static Z80STATE initial;
+static Z80ENGINE scalar, batch_lane, faulty;
+static Z80Batch batch(1);
+
+
+
+static void Scalar(Z80ENGINE *engine, Z80 *cpu, const char *name) {
+	engine->name = name;
+	engine->load = [cpu](const Z80STATE *state) { cpu->LoadState(state); };
+	engine->save = [cpu](Z80STATE *state) { cpu->SaveState(state); };
+	engine->step = [cpu](unsigned int n) {
+		for (unsigned int i = 0; i < n; i++) {
+			cpu->ExecuteInstruction();
+		}
+	};
+}
+
+
+
+// Lane 0 of a batch, going through a scalar CPU for what the lanes don't keep
+static void Batch(Z80ENGINE *engine, Z80Batch *batch, Z80 *shadow) {
+	engine->name = "batch";
+	engine->load = [batch, shadow](const Z80STATE *state) {
+		shadow->LoadState(state);
+		batch->Load(0, shadow);
+		memcpy(batch->GetMemory(0), state->memory, sizeof(Z80ADDRESSBUS));
+	};
+	engine->save = [batch, shadow](Z80STATE *state) {
+		batch->Store(0, shadow);
+		memcpy(shadow->memory, batch->GetMemory(0), sizeof(Z80ADDRESSBUS));
+		shadow->SaveState(state);
+	};
+	engine->step = [batch](unsigned int n) { batch->Run(n); };
+}
+
+
+
+// Corrupts a byte zexdoc never touches after the instruction that reaches
+// BISECT_FAULT, a flag would be recomputed before the next checkpoint
+static void Faulty(Z80ENGINE *engine, Z80 *cpu) {
+	Scalar(engine, cpu, "faulty");
+
+	engine->step = [cpu](unsigned int n) {
+		for (unsigned int i = 0; i < n; i++) {
+			ZQWORD before = cpu->GetClock();
+			cpu->ExecuteInstruction();
+			if (before < BISECT_FAULT && cpu->GetClock() >= BISECT_FAULT) {
+				cpu->memory[BISECT_ADDRESS] ^= 0x55;
+			}
+		}
+	};
+}
+
+
+
+int main(int argc, char *argv[]) {
+	const char *filename = argc > 1 ? argv[1] : "./test/zexdoc.com";
+	ZQWORD steps = argc > 2 ? atoll(argv[2]) : BISECT_STEPS;
+	int failed = 0;
+
+	Z80 cpu_a, cpu_b, shadow;
+	cpu_a.memory = memory_a;
+	cpu_b.memory = memory_b;
+	shadow.memory = memory_shadow;
+
+	if (!LoadZex(filename, memory_a)) {
+		return 1;
+	}
+	cpu_a.Reset();
+	cpu_a.SaveState(&initial);
+
+	Scalar(&scalar, &cpu_a, "scalar");
+	Batch(&batch_lane, &batch, &shadow);
+	Faulty(&faulty, &cpu_b);
+
+	Z80Bisect same(&scalar, &batch_lane);
+	long long at = same.Find(&initial, steps);
+	if (at >= 0) {
+		printf("Scalar core and batch lane disagree\n");
+		same.Show();
+		failed++;
+	}
+
+	// Where the fault has to be found
+	long long expected = 0;
+	cpu_a.LoadState(&initial);
+	while (cpu_a.GetClock() < BISECT_FAULT) {
+		cpu_a.ExecuteInstruction();
+		expected++;
+	}
+
+	Z80Bisect bisect(&scalar, &faulty);
+	at = bisect.Find(&initial, steps);
+	bisect.Show();
+	if (at != expected) {
+		printf("Found instruction %lld, the fault is at %lld\n", at, expected);
+		failed++;
+	}
+
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "z80.h"
+
+
+// __Z80BUSTIMING__ timestamps against the M-cycle breakdown of the data
+// sheet: every bus cycle of one instruction or interrupt acknowledge, its
+// type, address and first T-state, and the T-states the whole thing takes.
+// bustiming
+
+
+#define INT_NONE	0
+#define INT_NMI		1
+#define INT_IM0		2
+#define INT_IM1		3
+#define INT_IM2		4
+
+#define F	Z80BUS_FETCH
+#define R	Z80BUS_READ
+#define W	Z80BUS_WRITE
+#define IR	Z80BUS_IOREAD
+#define IW	Z80BUS_IOWRITE
+#define ACK	Z80BUS_INTACK
+
+
+typedef struct {
+	unsigned int tstate;
+	ZBYTE type;
+	ZWORD addr;
+} CYCLE;
+
+typedef struct {
+	const char *name;
+	ZBYTE code[4];
+	int event;
+	unsigned int tstates;
+	int count;
+	CYCLE cycles[6];
+} CASE;
+
+
+// PC 0100, SP 8000, IX and IY 4000, HL 5000, DE 6000, BC 0110, A and F 00,
+// I 20, memory all zeros but the code. IM 0 puts code[1..3] on the bus.
+static const CASE cases[] = {
+	{ "PUSH BC", { 0xc5 }, INT_NONE, 11, 3, { {0,F,0x0100}, {5,W,0x7fff}, {8,W,0x7ffe} } },
+	{ "POP BC", { 0xc1 }, INT_NONE, 10, 3, { {0,F,0x0100}, {4,R,0x8000}, {7,R,0x8001} } },
+	{ "RST 38", { 0xff }, INT_NONE, 11, 3, { {0,F,0x0100}, {5,W,0x7fff}, {8,W,0x7ffe} } },
+	{ "RET NZ", { 0xc0 }, INT_NONE, 11, 3, { {0,F,0x0100}, {5,R,0x8000}, {8,R,0x8001} } },
+	{ "CALL nn", { 0xcd, 0x34, 0x12 }, INT_NONE, 17, 5, { {0,F,0x0100}, {4,R,0x0101}, {7,R,0x0102}, {11,W,0x7fff}, {14,W,0x7ffe} } },
+	{ "EX (SP),HL", { 0xe3 }, INT_NONE, 19, 5, { {0,F,0x0100}, {4,R,0x8000}, {7,R,0x8001}, {11,W,0x8001}, {14,W,0x8000} } },
+	{ "DJNZ", { 0x10, 0xfe }, INT_NONE, 8, 2, { {0,F,0x0100}, {5,R,0x0101} } },
+	{ "INC (HL)", { 0x34 }, INT_NONE, 11, 3, { {0,F,0x0100}, {4,R,0x5000}, {8,W,0x5000} } },
+	{ "LD (nn),A", { 0x32, 0x34, 0x12 }, INT_NONE, 13, 4, { {0,F,0x0100}, {4,R,0x0101}, {7,R,0x0102}, {10,W,0x1234} } },
+	{ "OUT (n),A", { 0xd3, 0xfe }, INT_NONE, 11, 3, { {0,F,0x0100}, {4,R,0x0101}, {7,IW,0x00fe} } },
+	{ "SET 1,(HL)", { 0xcb, 0xce }, INT_NONE, 15, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000}, {12,W,0x5000} } },
+	{ "BIT 1,(HL)", { 0xcb, 0x4e }, INT_NONE, 12, 3, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000} } },
+	{ "IN A,(C)", { 0xed, 0x78 }, INT_NONE, 12, 3, { {0,F,0x0100}, {4,F,0x0101}, {8,IR,0x0110} } },
+	{ "LDI", { 0xed, 0xa0 }, INT_NONE, 16, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000}, {11,W,0x6000} } },
+	{ "LDIR", { 0xed, 0xb0 }, INT_NONE, 21, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000}, {11,W,0x6000} } },
+	{ "CPIR", { 0xed, 0xb1 }, INT_NONE, 16, 3, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000} } },
+	{ "INI", { 0xed, 0xa2 }, INT_NONE, 16, 4, { {0,F,0x0100}, {4,F,0x0101}, {9,IR,0x0110}, {13,W,0x5000} } },
+	{ "OUTI", { 0xed, 0xa3 }, INT_NONE, 16, 4, { {0,F,0x0100}, {4,F,0x0101}, {9,R,0x5000}, {12,IW,0x0010} } },
+	{ "RLD", { 0xed, 0x6f }, INT_NONE, 18, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x5000}, {15,W,0x5000} } },
+	{ "PUSH IX", { 0xdd, 0xe5 }, INT_NONE, 15, 4, { {0,F,0x0100}, {4,F,0x0101}, {9,W,0x7fff}, {12,W,0x7ffe} } },
+	{ "EX (SP),IX", { 0xdd, 0xe3 }, INT_NONE, 23, 6, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x8000}, {11,R,0x8001}, {15,W,0x8001}, {18,W,0x8000} } },
+	{ "LD B,(IX+d)", { 0xdd, 0x46, 0x05 }, INT_NONE, 19, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {16,R,0x4005} } },
+	{ "LD (IY+d),B", { 0xfd, 0x70, 0x05 }, INT_NONE, 19, 4, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {16,W,0x4005} } },
+	{ "LD (IX+d),n", { 0xdd, 0x36, 0x05, 0x77 }, INT_NONE, 19, 5, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {11,R,0x0103}, {16,W,0x4005} } },
+	{ "INC (IX+d)", { 0xdd, 0x34, 0x05 }, INT_NONE, 23, 5, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {16,R,0x4005}, {20,W,0x4005} } },
+	{ "SET 1,(IX+d)", { 0xdd, 0xcb, 0x05, 0xce }, INT_NONE, 23, 6, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {11,R,0x0103}, {16,R,0x4005}, {20,W,0x4005} } },
+	{ "BIT 1,(IY+d)", { 0xfd, 0xcb, 0x05, 0x4e }, INT_NONE, 20, 5, { {0,F,0x0100}, {4,F,0x0101}, {8,R,0x0102}, {11,R,0x0103}, {16,R,0x4005} } },
+	{ "NMI", { 0x00 }, INT_NMI, 11, 3, { {0,F,0x0100}, {5,W,0x7fff}, {8,W,0x7ffe} } },
+	{ "IM 0 RST 38", { 0x00, 0xff }, INT_IM0, 13, 3, { {0,ACK,0x0100}, {7,W,0x7fff}, {10,W,0x7ffe} } },
+	{ "IM 0 CALL nn", { 0x00, 0xcd, 0x34, 0x12 }, INT_IM0, 19, 5, { {0,ACK,0x0100}, {6,R,0x0100}, {9,R,0x0100}, {13,W,0x7fff}, {16,W,0x7ffe} } },
+	{ "IM 0 JP nn", { 0x00, 0xc3, 0x34, 0x12 }, INT_IM0, 12, 3, { {0,ACK,0x0100}, {6,R,0x0100}, {9,R,0x0100} } },
+	{ "IM 1", { 0x00 }, INT_IM1, 13, 3, { {0,ACK,0x0100}, {7,W,0x7fff}, {10,W,0x7ffe} } },
+	{ "IM 2", { 0x00 }, INT_IM2, 19, 5, { {0,ACK,0x0100}, {7,W,0x7fff}, {10,W,0x7ffe}, {13,R,0x2040}, {16,R,0x2041} } },
+};
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+static Z80STATE state;
+static std::vector<CYCLE> seen;
+static ZQWORD start;
+
+
+
+static ZBYTE In(ZWORD) {
+	return 0xff;
+}
+
+
+
+static void Out(ZWORD, ZBYTE) {
+}
+
+
+
+static void Bus(ZQWORD tstate, ZBYTE type, ZWORD addr, ZBYTE) {
+	CYCLE cycle = { (unsigned int) (tstate - start), type, addr };
+	seen.push_back(cycle);
+}
+
+
+
+static int Run(const CASE *c) {
+	memset(memory, 0, sizeof(memory));
+	memcpy(memory + 0x100, c->code, sizeof(c->code));
+
+	cpu.Reset();
+	cpu.SaveState(&state, false);
+	state.pc = 0x0100;
+	state.sp = 0x8000;
+	state.ix = state.iy = 0x4000;
+	state.hl = 0x5000;
+	state.de = 0x6000;
+	state.bc = 0x0110;
+	state.af = 0x0000;
+	state.ir = 0x2000;
+	if (c->event >= INT_IM0) {
+		state.iff1 = state.iff2 = 1;
+		state.im = c->event - INT_IM0;
+	}
+	cpu.LoadState(&state, false);
+
+	if (c->event == INT_NMI) {
+		cpu.NMI();
+	} else if (c->event == INT_IM0) {
+		cpu.IRQ(c->code[1], c->code[2] | (c->code[3] << 8));
+	} else if (c->event != INT_NONE) {
+		cpu.IRQ(c->event == INT_IM2 ? 0x40 : 0xff);
+	}
+
+	seen.clear();
+	start = cpu.GetClock();
+	cpu.ExecuteInstruction();
+	unsigned int tstates = (unsigned int) (cpu.GetClock() - start);
+
+	bool ok = tstates == c->tstates && (int) seen.size() == c->count;
+	for (int i = 0; ok && i < c->count; i++) {
+		ok = seen[i].tstate == c->cycles[i].tstate && seen[i].type == c->cycles[i].type &&
+			seen[i].addr == c->cycles[i].addr;
+	}
+
+	if (!ok) {
+		printf("%s: %u T-states, expected %u\n", c->name, tstates, c->tstates);
+		for (size_t i = 0; i < seen.size(); i++) {
+			printf("\t%u type %d %04X\n", seen[i].tstate, seen[i].type, seen[i].addr);
+		}
+		return 1;
+	}
+
+	return 0;
+}
+
+
+
+int main() {
+	cpu.memory = memory;
+	cpu.SetBusCallback(Bus);
+	cpu.SetIOReadCallback(In);
+	cpu.SetIOWriteCallback(Out);
+
+	int count = sizeof(cases) / sizeof(cases[0]);
+	int failed = 0;
+	for (int i = 0; i < count; i++) {
+		failed += Run(&cases[i]);
+	}
+
+	printf("%d CASES\n", count);
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#include "z80memory.h"
+#include "z80dedup.h"
+
+
+// Z80PageDedup over Z80Memory instances sharing a ROM image. Parked ones
+// must end up sharing every duplicate page, with the exact bytes saved; a
+// write must unshare only the writer's page; a running instance must be
+// left alone; contents must never change. Then background passes run while
+// one instance keeps writing.
+// dedup
+
+
+#define DEDUP_INSTANCES		4
+#define DEDUP_ROM			0x4000		// Same in all of them
+#define DEDUP_OWN			0x4000		// Different in each, from DEDUP_ROM up
+#define DEDUP_ZERO_PAGES	((0x10000 - DEDUP_ROM - DEDUP_OWN) / Z80MEM_PAGE_SIZE)
+#define DEDUP_ROM_PAGES		(DEDUP_ROM / Z80MEM_PAGE_SIZE)
+
+
+static ZBYTE images[DEDUP_INSTANCES + 1][0x10000];
+static ZBYTE check[0x10000];
+
+
+
+static void Random(ZBYTE *data, unsigned int len, unsigned int seed) {
+	for (unsigned int i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed >> 16;
+	}
+}
+
+
+
+static int Compare(Z80Memory *mem, const ZBYTE *image, const char *when) {
+	mem->Save(0x0000, check, 0x8000);
+	mem->Save(0x8000, check + 0x8000, 0x8000);
+	if (memcmp(check, image, sizeof(check))) {
+		printf("Contents changed %s\n", when);
+		return 1;
+	}
+	return 0;
+}
+
+
+
+int main() {
+	int failed = 0;
+
+	Z80Memory mem[DEDUP_INSTANCES + 1];
+	Z80PageDedup dedup;
+
+	for (int i = 0; i <= DEDUP_INSTANCES; i++) {
+		memset(images[i], 0, sizeof(images[i]));
+		Random(images[i], DEDUP_ROM, 1);
+		Random(images[i] + DEDUP_ROM, DEDUP_OWN, 100 + i);
+		mem[i].Load(0x0000, images[i], 0x8000);
+		dedup.Register(&mem[i]);
+	}
+
+	// The last one keeps running, the others go idle
+	for (int i = 0; i < DEDUP_INSTANCES; i++) {
+		mem[i].Park();
+	}
+	dedup.Pass();
+
+	// ROM pages: 4 copies, 3 saved each. Zero pages: 4 x 32 copies, all but one saved.
+	ZQWORD expected = (ZQWORD) DEDUP_ROM_PAGES * (DEDUP_INSTANCES - 1) * Z80MEM_PAGE_SIZE +
+		((ZQWORD) DEDUP_ZERO_PAGES * DEDUP_INSTANCES - 1) * Z80MEM_PAGE_SIZE;
+	if (dedup.GetBytesSaved() != expected) {
+		printf("Saved %llu bytes, expected %llu\n", dedup.GetBytesSaved(), expected);
+		failed++;
+	}
+	for (int i = 0; i < DEDUP_INSTANCES; i++) {
+		if (mem[i].SharedPages() != DEDUP_ROM_PAGES + DEDUP_ZERO_PAGES) {
+			printf("Instance %d shares %u pages\n", i, mem[i].SharedPages());
+			failed++;
+		}
+		failed += Compare(&mem[i], images[i], "by merging");
+	}
+	if (mem[DEDUP_INSTANCES].SharedPages() != 0) {
+		printf("A running instance got remapped\n");
+		failed++;
+	}
+
+	// Copy on write: only the writer's page goes private
+	mem[0].Unpark();
+	mem[0].Write(0x0010, images[0][0x0010] ^ 0xff);
+	images[0][0x0010] ^= 0xff;
+	mem[0].Park();
+	if (mem[0].SharedPages() != DEDUP_ROM_PAGES + DEDUP_ZERO_PAGES - 1 || mem[1].SharedPages() != DEDUP_ROM_PAGES + DEDUP_ZERO_PAGES) {
+		printf("Write unshared the wrong pages\n");
+		failed++;
+	}
+	for (int i = 0; i < DEDUP_INSTANCES; i++) {
+		failed += Compare(&mem[i], images[i], "by a write to another instance");
+	}
+
+	// Next pass: that ROM page has one copy fewer
+	dedup.Pass();
+	if (dedup.GetBytesSaved() != expected - Z80MEM_PAGE_SIZE) {
+		printf("After the write saved %llu bytes, expected %llu\n", dedup.GetBytesSaved(), expected - Z80MEM_PAGE_SIZE);
+		failed++;
+	}
+
+	// Background passes while instance 1 runs and writes, parking now and then
+	dedup.Start(1);
+	auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+	unsigned int seed = 7;
+	mem[1].Unpark();
+	while (std::chrono::steady_clock::now() < end) {
+		for (int i = 0; i < 1000; i++) {
+			seed = seed * 1103515245 + 12345;
+			ZWORD addr = (seed >> 8) & 0xffff;
+			ZBYTE val = seed >> 24;
+			mem[1].Write(addr, val);
+			images[1][addr] = val;
+		}
+		mem[1].Park();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		mem[1].Unpark();
+	}
+	mem[1].Park();
+	dedup.Stop();
+
+	for (int i = 0; i <= DEDUP_INSTANCES; i++) {
+		failed += Compare(&mem[i], images[i], "during background passes");
+	}
+
+	printf("%llu passes, %llu KB saved over %d instances of 64 KB\n",
+		dedup.GetPasses(), dedup.GetBytesSaved() / 1024, DEDUP_INSTANCES + 1);
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
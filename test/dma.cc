@@ -0,0 +1,162 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "z80.h"
+#include "z80dma.h"
+#include "z80memory.h"
+#include "expect.h"
+
+
+// WAIT / BUSREQ stalls and Z80DMA. A stall must hold the CPU for exactly
+// its T-states from the next instruction boundary, requests adding up;
+// DMA copies and fills must match a byte by byte transfer, overlaps and the
+// 64 KB wrap included, on flat memory and on Z80Memory alike, and charge
+// the CPU their bus time.
+// dma
+
+
+#define OUTS		40
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+static std::vector<ZQWORD> outs;
+static ZQWORD start;				// Reset() leaves the clock running
+
+
+
+static void Out(ZWORD, ZBYTE) {
+	outs.push_back(cpu.GetClock() - start);
+}
+
+
+
+// Clock of every OUT of the loop, with stall T-states requested at
+// clock 'at' (mid instruction)
+static std::vector<ZQWORD> Trace(unsigned int at, unsigned int wait, unsigned int busreq) {
+	// loop: OUT (10),A / INC A / JR loop, 27 T-states
+	static const ZBYTE code[] = { 0xd3, 0x10, 0x3c, 0x18, 0xfb };
+	memset(memory, 0, sizeof(memory));
+	memcpy(memory, code, sizeof(code));
+	cpu.Reset();
+	outs.clear();
+	start = cpu.GetClock();
+
+	cpu.ExecuteTStates(at);
+	cpu.Wait(wait);
+	cpu.BusRequest(busreq);
+	Expect(!cpu.isWaiting(), "Stalled CPU reported as waiting");
+	while (outs.size() < OUTS) {
+		cpu.ExecuteTStates(1);
+	}
+
+	return outs;
+}
+
+
+
+static void Shifted(const std::vector<ZQWORD> &base, const std::vector<ZQWORD> &stalled, ZQWORD at, ZQWORD by, const char *what) {
+	bool ok = true;
+	for (int i = 0; i < OUTS; i++) {
+		ok &= stalled[i] == (base[i] <= at ? base[i] : base[i] + by);
+	}
+	Expect(ok, what);
+}
+
+
+
+// Byte by byte upward transfer, the reference for Copy()
+static void Reference(ZBYTE *mem, ZWORD dst, ZWORD src, unsigned int len) {
+	for (unsigned int i = 0; i < len; i++) {
+		mem[(ZWORD) (dst + i)] = mem[(ZWORD) (src + i)];
+	}
+}
+
+
+
+int main() {
+	cpu.memory = memory;
+	cpu.SetIOWriteCallback(Out);
+
+	// Stalls start at the next instruction boundary and delay everything after
+	std::vector<ZQWORD> base = Trace(100, 0, 0);
+	Shifted(base, Trace(100, 13, 0), 100, 13, "WAIT didn't delay by its T-states");
+	Shifted(base, Trace(100, 0, 50), 100, 50, "BUSREQ didn't delay by its T-states");
+	Shifted(base, Trace(100, 30, 70), 100, 100, "WAIT and BUSREQ didn't add up");
+
+	// DMA on flat memory: overlapping upward (repeats the first byte),
+	// downward, across the top of the address space, fill with wrap
+	static ZBYTE expected[0x10000];
+	for (int i = 0; i < 0x10000; i++) {
+		expected[i] = (ZBYTE) (i * 7);
+	}
+	memcpy(memory, expected, sizeof(memory));
+
+	Z80DMA dma(&cpu);
+	unsigned int charged = 0;
+	charged += dma.Copy(0x4001, 0x4000, 300);
+	Reference(expected, 0x4001, 0x4000, 300);
+	charged += dma.Copy(0x5000, 0x5010, 100);
+	Reference(expected, 0x5000, 0x5010, 100);
+	charged += dma.Copy(0xfff0, 0x1000, 64);
+	Reference(expected, 0xfff0, 0x1000, 64);
+	charged += dma.Copy(0x2000, 0xffe0, 64);
+	Reference(expected, 0x2000, 0xffe0, 64);
+	charged += dma.Fill(0xff00, 0x5a, 0x200);
+	for (int i = 0; i < 0x200; i++) {
+		expected[(ZWORD) (0xff00 + i)] = 0x5a;
+	}
+	Expect(memcmp(memory, expected, sizeof(memory)) == 0, "Flat memory DMA differs from a byte by byte transfer");
+	Expect(charged == (300 + 100 + 64 + 64 + 0x200) * 6, "DMA charged the wrong T-states");
+
+	// The CPU, at a boundary after the last OUT, stays off the bus for all of it
+	static Z80STATE before, after;
+	cpu.SaveState(&before, false);
+	cpu.ExecuteTStates(charged);
+	cpu.SaveState(&after, false);
+	Expect(after.pc == before.pc, "CPU ran during the DMA");
+	cpu.ExecuteTStates(4);
+	cpu.SaveState(&after, false);
+	Expect(after.pc != before.pc, "CPU still stalled after the DMA");
+
+	// Same operations on a Z80Memory
+	static ZBYTE paged[0x10000];
+	for (int i = 0; i < 0x10000; i++) {
+		paged[i] = (ZBYTE) (i * 7);
+	}
+	Z80Memory mem;
+	mem.Load(0, paged, 0x10000);
+	Z80DMA paged_dma(&cpu, &mem);
+	paged_dma.Copy(0x4001, 0x4000, 300);
+	paged_dma.Copy(0x5000, 0x5010, 100);
+	paged_dma.Copy(0xfff0, 0x1000, 64);
+	paged_dma.Copy(0x2000, 0xffe0, 64);
+	paged_dma.SetByteTStates(4);
+	Expect(paged_dma.Fill(0xff00, 0x5a, 0x200) == 0x200 * 4, "SetByteTStates() ignored");
+	mem.Save(0, paged, 0x10000);
+	Expect(memcmp(paged, expected, sizeof(paged)) == 0, "Z80Memory DMA differs from a byte by byte transfer");
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEST_EXPECT_H_
+#define TEST_EXPECT_H_
+
+#include <stdio.h>
+
+
+// Checks shared by the feature tests: a failing one prints what went wrong
+// and counts in failed, which each test reports as "FAILED: n" at the end.
+
+static int failed = 0;
+
+
+
+static void Expect(bool ok, const char *what) {
+	if (!ok) {
+		printf("%s\n", what);
+		failed++;
+	}
+}
+
+#endif
@@ -0,0 +1,273 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "z80.h"
+#include "z80explore.h"
+
+
+// Z80Explorer on two small guests driven by IN (0), one step per NMI.
+//
+// A maze walker: the position is the whole state, so breadth first must
+// find exactly the open cells reachable from the start and a path of the
+// shortest length, best-first (closer to the goal first) a valid one.
+// A base 4 counter: every input sequence gives a new state, wide enough to
+// keep all workers busy; 1 and several threads must agree state for state.
+// Every path found is replayed on a plain Z80.
+// explore [threads]
+
+
+#define EXPLORE_STEP		10000		// T-states per input
+#define EXPLORE_POS			0x8000
+#define EXPLORE_MAZE		0x9000
+#define EXPLORE_START		0x11		// y * 16 + x
+#define EXPLORE_GOAL		0xee
+#define EXPLORE_COUNTER		0x1234
+
+
+// Both halt after setup and loop on HALT, NMI at 0066 just returns. R is
+// reset every step and both run in constant time, the maze walker in a
+// multiple of 4 T-states so the HALT NOPs keep their phase: a position is
+// the same state however it was reached.
+static const ZBYTE maze_code[] = {
+	0x31, 0x00, 0xf0,		// LD SP, F000
+	0x76,					// loop: HALT
+	0xaf, 0xed, 0x4f,		// XOR A / LD R, A
+	0xdb, 0x00,				// IN A, (0)
+	0xe6, 0x03,				// AND 3
+	0x5f, 0x16, 0x88,		// LD E, A / LD D, 88
+	0x1a,					// LD A, (DE)			Step from the table at 8800
+	0x21, 0x00, 0x80,		// LD HL, 8000
+	0x86,					// ADD A, (HL)
+	0x5f, 0x16, 0x90,		// LD E, A / LD D, 90
+	0x1a, 0x4f,				// LD A, (DE) / LD C, A	FF on a wall
+	0x2f, 0xa3, 0x47,		// CPL / AND E / LD B, A
+	0x79, 0xa6, 0xb0,		// LD A, C / AND (HL) / OR B
+	0xd8,					// RET C				Never, pads to 184 T-states
+	0x77,					// LD (HL), A			New or old position
+	0x01, 0x00, 0x00,		// LD BC, 0
+	0x50, 0x58,				// LD D, B / LD E, B
+	0xc3, 0x03, 0x01		// JP loop
+};
+
+static const ZBYTE counter_code[] = {
+	0x31, 0x00, 0xf0,		// LD SP, F000
+	0x76,					// loop: HALT
+	0xaf, 0xed, 0x4f,		// XOR A / LD R, A
+	0xdb, 0x00,				// IN A, (0)
+	0xe6, 0x03,				// AND 3
+	0x5f, 0x16, 0x00,		// LD E, A / LD D, 0
+	0x2a, 0x00, 0x80,		// LD HL, (8000)
+	0x29, 0x29, 0x19,		// ADD HL, HL / ADD HL, HL / ADD HL, DE
+	0x22, 0x00, 0x80,		// LD (8000), HL
+	0xc3, 0x03, 0x01		// JP loop
+};
+
+
+static Z80ADDRESSBUS memory;
+static Z80STATE maze, counter;
+static int distance[256];
+
+
+
+// Up, down, left, right
+static const int steps[4] = { -16, 16, -1, 1 };
+
+
+
+// Border all walls, a third of the rest too. Fills distance[] from the start
+// (-1 if unreachable), returns how many cells can be reached.
+static int BuildMaze(unsigned int seed) {
+	memset(memory, 0, sizeof(memory));
+
+	for (int p = 0; p < 256; p++) {
+		seed = seed * 1103515245 + 12345;
+		int x = p & 15, y = p >> 4;
+		bool wall = x == 0 || y == 0 || x == 15 || y == 15 || ((seed >> 16) % 3) == 0;
+		memory[EXPLORE_MAZE + p] = wall && p != EXPLORE_START && p != EXPLORE_GOAL ? 0xff : 0x00;
+	}
+	for (int i = 0; i < 4; i++) {
+		memory[0x8800 + i] = (ZBYTE) steps[i];
+	}
+	memory[EXPLORE_POS] = EXPLORE_START;
+
+	std::vector<int> queue(1, EXPLORE_START);
+	int reached = 1;
+	for (int p = 0; p < 256; p++) {
+		distance[p] = -1;
+	}
+	distance[EXPLORE_START] = 0;
+	for (size_t i = 0; i < queue.size(); i++) {
+		for (int d = 0; d < 4; d++) {
+			int next = queue[i] + steps[d];
+			if (memory[EXPLORE_MAZE + next] == 0 && distance[next] < 0) {
+				distance[next] = distance[queue[i]] + 1;
+				queue.push_back(next);
+				reached++;
+			}
+		}
+	}
+
+	return reached;
+}
+
+
+
+// Runs the program in memory[] up to its first HALT
+static void Boot(const ZBYTE *code, size_t size, Z80STATE *state) {
+	memory[0x0000] = 0xc3;		// JP 0100
+	memory[0x0001] = 0x00;
+	memory[0x0002] = 0x01;
+	memory[0x0066] = 0xed;		// RETN
+	memory[0x0067] = 0x45;
+	memcpy(&memory[0x100], code, size);
+
+	Z80 cpu;
+	cpu.memory = memory;
+	cpu.Reset();
+	while (!cpu.isHalted()) {
+		cpu.ExecuteTStates(1);
+	}
+	cpu.SaveState(state);
+}
+
+
+
+// Plays the inputs on a plain Z80, returns the word at EXPLORE_POS
+static unsigned int Replay(const Z80STATE *state, const std::vector<unsigned int> &path) {
+	unsigned int input = 0;
+
+	Z80 cpu;
+	cpu.memory = memory;
+	cpu.SetIOReadCallback([&input](ZWORD) -> ZBYTE { return input; });
+	cpu.LoadState(state);
+
+	for (auto i : path) {
+		input = i;
+		cpu.NMI();
+		cpu.ExecuteTStates(EXPLORE_STEP);
+	}
+
+	return memory[EXPLORE_POS] | (memory[EXPLORE_POS + 1] << 8);
+}
+
+
+
+static void Setup(Z80Explorer *explorer) {
+	explorer->SetInputCallback([](ZWORD, unsigned int input) -> ZBYTE { return input; });
+	explorer->SetStepCallback([](Z80 *cpu) { cpu->NMI(); });
+}
+
+
+
+static void Show(const char *name, Z80Explorer *explorer) {
+	Z80EXPLORESTATS stats = explorer->GetStats();
+
+	printf("%-22s %6llu states %6llu duplicates %6llu steps, depth %2u, %7.0f steps/s, peak %5llu KB of pages\n",
+		name, stats.states, stats.duplicates, stats.steps, stats.depth,
+		stats.steps / stats.seconds, stats.peak_pages * Z80HASH_PAGE_SIZE / 1024);
+}
+
+
+
+int main(int argc, char *argv[]) {
+	unsigned int threads = argc > 1 ? atoi(argv[1]) : 4;
+	int failed = 0;
+
+	unsigned int seed = 1;
+	int reachable;
+	while ((reachable = BuildMaze(seed)) && distance[EXPLORE_GOAL] < 0) {
+		seed++;
+	}
+	Boot(maze_code, sizeof(maze_code), &maze);
+
+	Z80Explorer explorer(4, EXPLORE_STEP, threads);
+	Setup(&explorer);
+
+	// Everything reachable, plus the state right after setup
+	explorer.Explore(&maze, 1000000, 1000);
+	Show("maze, everything", &explorer);
+	if (explorer.GetStats().states != (ZQWORD) reachable + 1) {
+		printf("Found %llu states, %d cells are reachable\n", explorer.GetStats().states, reachable);
+		failed++;
+	}
+
+	// Breadth first: shortest
+	explorer.SetGoalCallback([](Z80 *cpu) { return cpu->memory[EXPLORE_POS] == EXPLORE_GOAL; });
+	long long goal = explorer.Explore(&maze, 1000000, 1000);
+	Show("maze, breadth first", &explorer);
+	std::vector<unsigned int> path = explorer.GetPath(goal);
+	if (goal < 0 || (int) path.size() != distance[EXPLORE_GOAL] || Replay(&maze, path) != EXPLORE_GOAL) {
+		printf("Breadth first: %zu steps to the goal, %d is the shortest\n", path.size(), distance[EXPLORE_GOAL]);
+		failed++;
+	}
+	ZQWORD bfs_steps = explorer.GetStats().steps;
+
+	// Best-first, closer goes first
+	explorer.SetScoreCallback([](Z80 *cpu) -> double {
+		int p = cpu->memory[EXPLORE_POS];
+		return -abs((p & 15) - (EXPLORE_GOAL & 15)) - abs((p >> 4) - (EXPLORE_GOAL >> 4));
+	});
+	explorer.SetBatch(1);
+	goal = explorer.Explore(&maze, 1000000, 1000);
+	Show("maze, best-first", &explorer);
+	path = explorer.GetPath(goal);
+	if (goal < 0 || Replay(&maze, path) != EXPLORE_GOAL) {
+		printf("Best-first didn't reach the goal\n");
+		failed++;
+	}
+	printf("best-first reached it with %zu steps (shortest %d) after %llu steps, breadth first after %llu\n",
+		path.size(), distance[EXPLORE_GOAL], explorer.GetStats().steps, bfs_steps);
+
+	// Counter, 4^7 values: same states with 1 and with all threads
+	memset(memory, 0, sizeof(memory));
+	Boot(counter_code, sizeof(counter_code), &counter);
+
+	std::vector<unsigned int> paths[2];
+	ZQWORD states[2];
+	ZQWORD peak = 0;
+	for (int i = 0; i < 2; i++) {
+		Z80Explorer wide(4, EXPLORE_STEP, i ? threads : 1);
+		Setup(&wide);
+		wide.SetGoalCallback([](Z80 *cpu) {
+			return (cpu->memory[EXPLORE_POS] | (cpu->memory[EXPLORE_POS + 1] << 8)) == EXPLORE_COUNTER;
+		});
+		goal = wide.Explore(&counter, 1000000, 7);
+		paths[i] = wide.GetPath(goal);
+		states[i] = wide.GetStats().states;
+		peak = wide.GetStats().peak_pages;
+
+		char name[32];
+		snprintf(name, sizeof(name), "counter, %u thread%s", wide.GetThreads(), i && threads > 1 ? "s" : "");
+		Show(name, &wide);
+	}
+	if (paths[0] != paths[1] || states[0] != states[1] || Replay(&counter, paths[0]) != EXPLORE_COUNTER ||
+		paths[0] != std::vector<unsigned int>({1, 0, 2, 0, 3, 1, 0})) {
+		printf("Counter: paths or states differ between thread counts\n");
+		failed++;
+	}
+	printf("counter: %llu KB of pages at the peak for %llu states, %llu MB as whole Z80STATEs\n",
+		peak * Z80HASH_PAGE_SIZE / 1024, states[0], states[0] * sizeof(Z80STATE) >> 20);
+
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <new>
+#include <vector>
+
+#include "z80.h"
+
+
+// Bytes per instance and constructions per second for a fleet of CPUs.
+// Heap use is counted by replacing the global operator new, so callbacks
+// that spill out of std::function's inline storage show up.
+// footprint [instances]
+
+
+#define FOOTPRINT_INSTANCES	100000
+
+
+static size_t heap_bytes = 0;
+static size_t heap_blocks = 0;
+
+
+
+void *operator new(size_t size) {
+	heap_bytes += size;
+	heap_blocks++;
+
+	void *p = malloc(size);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+
+
+void operator delete(void *p) noexcept {
+	free(p);
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int instances = argc > 1 ? atoi(argv[1]) : FOOTPRINT_INSTANCES;
+	std::vector<Z80 *> fleet;
+
+	fleet.reserve(instances);
+
+	size_t bytes = heap_bytes;
+	size_t blocks = heap_blocks;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < instances; i++) {
+		fleet.push_back(new Z80());
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	bytes = heap_bytes - bytes;
+	blocks = heap_blocks - blocks;
+	double seconds = std::chrono::duration<double>(end - start).count();
+
+	printf("sizeof(Z80)        %8zu bytes\n", sizeof(Z80));
+	printf("heap per instance  %8.1f bytes in %.1f blocks\n", (double) bytes / instances, (double) blocks / instances);
+	printf("constructions      %8d in %.3f s, %.0f per second\n", instances, seconds, instances / seconds);
+
+	for (auto cpu : fleet) {
+		delete cpu;
+	}
+
+	return 0;
+}
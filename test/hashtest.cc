@@ -0,0 +1,159 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "z80.h"
+#include "z80dma.h"
+#include "z80hash.h"
+#include "zexfixture.h"
+
+
+// Z80StateHash on zexdoc. After every frame the incrementally updated
+// fingerprint must equal one computed from scratch; a host write must
+// change it and undoing it must bring it back, and host writes over
+// unaligned spans and DMA transfers must be picked up. Times full and
+// incremental updates.
+// hashtest [program.com] [frames]
+
+
+#define HASH_FRAME		69888
+#define HASH_FRAMES		2000
+
+
+static Z80ADDRESSBUS memory;
+static Z80STATE state;
+
+
+
+static bool Equal(Z80FINGERPRINT a, Z80FINGERPRINT b) {
+	return a.lo == b.lo && a.hi == b.hi;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	const char *filename = argc > 1 ? argv[1] : "./test/zexdoc.com";
+	int frames = argc > 2 ? atoi(argv[2]) : HASH_FRAMES;
+	int failed = 0;
+
+	if (!LoadZex(filename, memory)) {
+		return 1;
+	}
+
+	Z80 cpu;
+	cpu.memory = memory;
+	cpu.Reset();
+
+	Z80StateHash incremental(&cpu);
+	Z80StateHash full(&cpu);
+	incremental.Update();
+
+	double incremental_ns = 0;
+	double full_ns = 0;
+
+	for (int i = 0; i < frames; i++) {
+		cpu.ExecuteTStates(HASH_FRAME);
+
+		auto start = std::chrono::steady_clock::now();
+		Z80FINGERPRINT a = incremental.Update();
+		auto middle = std::chrono::steady_clock::now();
+		full.Invalidate();
+		Z80FINGERPRINT b = full.Update();
+		auto end = std::chrono::steady_clock::now();
+
+		incremental_ns += std::chrono::duration<double, std::nano>(middle - start).count();
+		full_ns += std::chrono::duration<double, std::nano>(end - middle).count();
+
+		if (!Equal(a, b)) {
+			if (failed++ < 10) {
+				printf("Frame %d: incremental fingerprint differs from a full one\n", i);
+			}
+		}
+	}
+
+	// A host write, seen through Touch(), then undone
+	Z80FINGERPRINT before = incremental.Update();
+	memory[0x8123] ^= 0x01;
+	incremental.Touch(0x8123, 1);
+	Z80FINGERPRINT changed = incremental.Update();
+	memory[0x8123] ^= 0x01;
+	incremental.Touch(0x8123, 1);
+	if (Equal(before, changed) || !Equal(before, incremental.Update())) {
+		printf("Memory change not reflected\n");
+		failed++;
+	}
+
+	// Host writes over an unaligned span whose last byte is alone on its
+	// page, then DMA fills and copies, unaligned and wrapping at 64 KB
+	memset(&memory[0x40ff], 0xa5, 0x102);
+	incremental.Touch(0x40ff, 0x102);
+	Z80FINGERPRINT now = incremental.Update();
+	full.Invalidate();
+	if (!Equal(now, full.Update())) {
+		printf("Unaligned host write not reflected\n");
+		failed++;
+	}
+
+	Z80DMA dma(&cpu);
+	dma.Fill(0xff80, 0x5a, 0x300);
+	dma.Copy(0x30f0, 0x1234, 0x221);
+	dma.Copy(0xfff0, 0x8000, 0x20);
+	now = incremental.Update();
+	full.Invalidate();
+	if (!Equal(now, full.Update())) {
+		printf("DMA writes not reflected\n");
+		failed++;
+	}
+
+	// Same machine at another time: differs, unless counters are off
+	cpu.SaveState(&state);
+	state.clock += 1000;
+	cpu.LoadState(&state);
+	if (Equal(before, incremental.Update())) {
+		printf("Clock change not reflected\n");
+		failed++;
+	}
+	incremental.SetCounters(false);
+	full.SetCounters(false);
+	Z80FINGERPRINT later = incremental.Update();
+	state.clock -= 1000;
+	cpu.LoadState(&state);
+	if (!Equal(later, full.Update())) {
+		printf("Counters still hashed\n");
+		failed++;
+	}
+
+	// Kernel throughput
+	const int rounds = 20000;
+	ZQWORD sink = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < rounds; i++) {
+		sink += Z80StateHash::Hash(memory, sizeof(memory), i).lo;
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	printf("Update() %.2f us incremental, %.2f us full (64 KB + registers)\n",
+		incremental_ns / frames / 1000, full_ns / frames / 1000);
+	printf("Page kernel %.2f GB/s (%llx)\n", (double) rounds * sizeof(memory) / seconds / 1e9, sink & 0xff);
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80record.h"
+#include "expect.h"
+
+
+// NMI and INT acceptance: T-states, pushed address, target and IFFs for NMI
+// and IM 0 / 1 / 2, the one instruction delay after EI, the acknowledge
+// callback of a daisy chain and the RETI callback. An IM 0 CALL taken from
+// the callback is recorded and replayed too.
+// interrupts
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+static Z80STATE state;
+
+static const ZBYTE *chain;		// Bytes the acknowledge callback hands out
+static int acks = 0;
+static int retis = 0;
+
+
+
+static ZBYTE Acknowledge() {
+	cpu.ClearIRQ();
+	return chain[acks++];
+}
+
+
+
+static void RETI() {
+	retis++;
+}
+
+
+
+// PC 0100, SP 8000, I 20, memory all zeros (NOPs)
+
+static void Setup(ZBYTE im, ZBYTE iff) {
+	memset(memory, 0, sizeof(memory));
+	cpu.Reset();
+	cpu.SaveState(&state, false);
+	state.pc = 0x0100;
+	state.sp = 0x8000;
+	state.ir = 0x2000;
+	state.iff1 = state.iff2 = iff;
+	state.im = im;
+	cpu.LoadState(&state, false);
+}
+
+
+
+// Runs the acceptance and checks where it went
+
+static void Accept(const char *name, unsigned int tstates, ZWORD pc, ZWORD sp) {
+	ZQWORD start = cpu.GetClock();
+	cpu.ExecuteInstruction();
+	unsigned int ts = (unsigned int) (cpu.GetClock() - start);
+	cpu.ClearIRQ();
+	cpu.SaveState(&state, false);
+
+	bool ok = ts == tstates && state.pc == pc && state.sp == sp;
+	if (ok && sp != 0x8000) {
+		ok = (memory[sp] | (memory[sp + 1] << 8)) == 0x0100;
+	}
+	if (!ok) {
+		printf("%s: %u T-states, PC %04X, SP %04X\n", name, ts, state.pc, state.sp);
+		failed++;
+	}
+}
+
+
+
+int main() {
+	cpu.memory = memory;
+
+	Setup(1, 1);
+	cpu.NMI();
+	Accept("NMI", 11, 0x0066, 0x7ffe);
+	Expect(state.iff1 == 0 && state.iff2 == 1, "NMI: IFF2 must keep IFF1");
+
+	Setup(0, 1);
+	cpu.IRQ(0xff);
+	Accept("IM 0 RST 38", 13, 0x0038, 0x7ffe);
+	Expect(state.iff1 == 0 && state.iff2 == 0, "INT must clear both IFFs");
+
+	Setup(0, 1);
+	cpu.IRQ(0xcd, 0x1234);
+	Accept("IM 0 CALL nn", 19, 0x1234, 0x7ffe);
+
+	Setup(0, 1);
+	cpu.IRQ(0xc3, 0x1234);
+	Accept("IM 0 JP nn", 12, 0x1234, 0x8000);
+
+	Setup(1, 1);
+	cpu.IRQ();
+	Accept("IM 1", 13, 0x0038, 0x7ffe);
+
+	Setup(2, 1);
+	memory[0x2040] = 0x78;
+	memory[0x2041] = 0x56;
+	cpu.IRQ(0x40);
+	Accept("IM 2", 19, 0x5678, 0x7ffe);
+
+	// Disabled, the request waits
+	Setup(1, 0);
+	cpu.IRQ();
+	cpu.ExecuteInstruction();
+	cpu.ClearIRQ();
+	cpu.SaveState(&state, false);
+	Expect(state.pc == 0x0101, "INT taken with IFF1 clear");
+
+	// EI: NOP runs before the INT, which then returns to the second NOP
+	Setup(1, 0);
+	memory[0x0100] = 0xfb;
+	cpu.IRQ();
+	cpu.ExecuteInstruction();
+	cpu.ExecuteInstruction();
+	cpu.SaveState(&state, false);
+	Expect(state.pc == 0x0102, "INT taken right after EI");
+	cpu.ExecuteInstruction();
+	cpu.ClearIRQ();
+	cpu.SaveState(&state, false);
+	Expect(state.pc == 0x0038 && memory[0x7ffe] == 0x02 && memory[0x7fff] == 0x01, "INT not taken after the instruction following EI");
+
+	// Daisy chain: the callback picks the vector, the byte given to IRQ()
+	// is ignored
+	cpu.SetIRQAckCallback(Acknowledge);
+	cpu.SetRETICallback(RETI);
+
+	static const ZBYTE vector[] = { 0x42 };
+	Setup(2, 1);
+	memory[0x2042] = 0x00;
+	memory[0x2043] = 0x30;
+	chain = vector;
+	acks = 0;
+	cpu.IRQ(0x40);
+	Accept("IM 2 daisy chain", 19, 0x3000, 0x7ffe);
+	Expect(acks == 1, "IM 2 must acknowledge once");
+
+	static const ZBYTE call[] = { 0xcd, 0x78, 0x56 };
+	Setup(0, 1);
+	chain = call;
+	acks = 0;
+	cpu.IRQ();
+	Accept("IM 0 CALL nn daisy chain", 19, 0x5678, 0x7ffe);
+	Expect(acks == 3, "IM 0 CALL must read its address off the bus");
+
+	// RETI from the handler above
+	memory[0x5678] = 0xed;
+	memory[0x5679] = 0x4d;
+	retis = 0;
+	cpu.ExecuteInstruction();
+	cpu.SaveState(&state, false);
+	Expect(retis == 1 && state.pc == 0x0100 && state.sp == 0x8000, "RETI callback not called");
+
+	// Record the daisy chain IM 0 CALL, then replay it with no callback
+	Z80STATE begin;
+	Z80Recorder recorder;
+	Setup(0, 1);
+	memory[0x5678] = 0x76;
+	cpu.SaveState(&begin, true);
+	recorder.Start(&cpu);
+	chain = call;
+	acks = 0;
+	cpu.ExecuteTStates(10);
+	cpu.IRQ();
+	cpu.ExecuteTStates(40);
+	recorder.Stop();
+	Z80STATE end;
+	cpu.SaveState(&end, false);
+
+	cpu.LoadState(&begin, true);
+	Z80Replayer replayer(&cpu, recorder.GetStream().data(), recorder.GetStream().size());
+	replayer.ExecuteTStates(50);
+	cpu.SaveState(&state, false);
+	Expect(replayer.Finished() && replayer.GetMismatches() == 0, "Replay diverged");
+	Expect(state.pc == end.pc && end.pc == 0x5678, "Replayed IM 0 CALL went elsewhere");
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80iolog.h"
+#include "expect.h"
+
+
+// Z80IOLog overflow. A frame writing far more than the log holds must keep
+// every buffered write in the log, in order and with its T-state, none of
+// them reaching IOWriteCallback; unbuffered ports still go straight out.
+// iolog
+
+
+#define WRITES		100
+#define CAPACITY	8
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+static int direct = 0;
+static int other = 0;
+
+
+
+static void Out(ZWORD port, ZBYTE) {
+	if ((port & 0xff) == 0xfe) {
+		direct++;
+	} else {
+		other++;
+	}
+}
+
+
+
+int main() {
+	// loop: OUT (FE),A / OUT (FD),A / INC A / JR loop, 11 + 11 + 4 + 12 T-states
+	static const ZBYTE code[] = { 0xd3, 0xfe, 0xd3, 0xfd, 0x3c, 0x18, 0xf9 };
+	memcpy(memory, code, sizeof(code));
+	cpu.memory = memory;
+	cpu.Reset();
+	cpu.SetIOWriteCallback(Out);
+
+	Z80IOLog log(CAPACITY);
+	log.BufferPort(0xfe);
+
+	cpu.ExecuteFrame(38 * WRITES, &log);
+
+	Expect(direct == 0, "Buffered writes reached IOWriteCallback");
+	Expect(other == WRITES, "Unbuffered writes didn't go straight out");
+	Expect(log.Size() == WRITES, "Writes missing from the log");
+	Expect(log.Overflows() > 0, "Log didn't report growing");
+
+	const Z80IOEVENT *events = log.Events();
+	for (unsigned int i = 0; i < log.Size(); i++) {
+		// A starts at FF after Reset(), stamped with the OUT's last T-state
+		ZBYTE a = (ZBYTE) (0xff + i);
+		if (events[i].value != a || events[i].tstate != 38 * (ZQWORD) i + 10 || events[i].port != ((a << 8) | 0xfe)) {
+			Expect(false, "Log out of order");
+			break;
+		}
+	}
+
+	log.Clear();
+	Expect(log.Size() == 0 && log.Overflows() == 0, "Clear() left events behind");
+
+	printf("%u WRITES\n", (unsigned int) WRITES);
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "expect.h"
+
+
+// Z80IRQSTATS bookkeeping: a handler entered with SP wrapping around 64 KB
+// is seen returning, handlers nested past Z80IRQ_NESTING don't pop the
+// tracked ones, and only requests dropped or repeated while IFF1 is 0
+// count as missed.
+// irqstats
+
+
+#define EXTRA		4		// Levels nested past Z80IRQ_NESTING
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+static Z80STATE state;
+static Z80IRQSTATS stats;
+
+
+
+// PC 0100, IM 1, handler at 0038: EI / NOP / RET, so a held INT nests
+// again right after the NOP and every level returns to the RET at 003A
+
+static void Setup(ZWORD sp, ZBYTE iff) {
+	memset(memory, 0, sizeof(memory));
+	memory[0x0038] = 0xfb;
+	memory[0x003a] = 0xc9;
+
+	cpu.Reset();
+	cpu.SaveState(&state, false);
+	state.pc = 0x0100;
+	state.sp = sp;
+	state.iff1 = state.iff2 = iff;
+	state.im = 1;
+	cpu.LoadState(&state, false);
+	cpu.SetIRQStats(&stats);
+}
+
+
+
+int main() {
+	cpu.memory = memory;
+
+	// Return address pushed at FFFF / 0000
+	Setup(0x0001, 1);
+	cpu.IRQ();
+	cpu.ExecuteInstruction();
+	cpu.ClearIRQ();
+	for (int i = 0; i < 3; i++) {
+		cpu.ExecuteInstruction();
+	}
+	cpu.SaveState(&state, false);
+	Expect(state.pc == 0x0100 && state.sp == 0x0001, "Wrapped handler didn't run");
+	Expect(stats.services == 1 && stats.depth == 0, "Wrapped handler return not seen");
+
+	// Nested past the tracked levels, then everything returns
+	Setup(0x8000, 1);
+	cpu.IRQ();
+	cpu.ExecuteInstruction();
+	for (int i = 1; i < Z80IRQ_NESTING + EXTRA; i++) {
+		cpu.ExecuteInstruction();
+		cpu.ExecuteInstruction();
+		cpu.ExecuteInstruction();
+	}
+	cpu.ClearIRQ();
+	Expect(stats.accepted == Z80IRQ_NESTING + EXTRA, "Wrong number of nested entries");
+	Expect(stats.depth == Z80IRQ_NESTING && stats.max_depth == Z80IRQ_NESTING, "Tracked depth wrong");
+	Expect(stats.untracked == EXTRA, "Levels past Z80IRQ_NESTING not counted");
+
+	// EI / NOP / RET of the innermost, then the untracked ones return
+	for (int i = 0; i < 3 + EXTRA - 1; i++) {
+		cpu.ExecuteInstruction();
+	}
+	Expect(stats.services == 0 && stats.depth == Z80IRQ_NESTING, "Untracked return popped a tracked level");
+
+	cpu.ExecuteInstruction();
+	Expect(stats.services == 1 && stats.depth == Z80IRQ_NESTING - 1, "Deepest tracked level not popped");
+
+	for (int i = 1; i < Z80IRQ_NESTING; i++) {
+		cpu.ExecuteInstruction();
+	}
+	cpu.SaveState(&state, false);
+	Expect(state.pc == 0x0100 && state.sp == 0x8000, "Nested handlers didn't unwind");
+	Expect(stats.services == Z80IRQ_NESTING && stats.depth == 0, "Tracked levels not all popped");
+
+	// Repeated and released while enabled: not missed
+	Setup(0x8000, 1);
+	cpu.IRQ();
+	cpu.IRQ();
+	cpu.ClearIRQ();
+	Expect(stats.requests == 1 && stats.missed == 0, "Request counted as missed with IFF1 set");
+
+	// Repeated and released while disabled: missed twice
+	Setup(0x8000, 0);
+	cpu.IRQ();
+	cpu.ExecuteInstruction();
+	cpu.IRQ();
+	cpu.ClearIRQ();
+	Expect(stats.requests == 1 && stats.missed == 2 && stats.accepted == 0, "Masked request not counted as missed");
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80machine.h"
+#include "expect.h"
+
+
+// Z80Machine quantum sync. Every Run() must leave all CPUs exactly at the
+// machine time; round-robin, a CPU never sees another more than a quantum
+// away; a SharedAccess() lets the current quantum finish, drops the next
+// one to the minimum and it doubles back up after; threaded runs end at
+// the same clocks. A CPU suspended on an IN ends Run() after that quantum
+// and catches up once resumed.
+// machine
+
+
+#define QUANTUM		1000
+#define MIN_QUANTUM	20
+
+
+static Z80ADDRESSBUS memory[2];
+static Z80 cpu[2];
+static Z80Machine machine;
+static ZQWORD max_skew = 0;
+static bool measure = true;		// Round-robin only, the other CPU is idle
+static int shared = 0;			// OUTs left that call SharedAccess()
+static bool hold = false;		// CPU 1's INs wait for ResumeIO()
+
+
+
+static void Out(ZWORD, ZBYTE) {
+	if (measure) {
+		ZQWORD a = cpu[0].GetClock();
+		ZQWORD b = cpu[1].GetClock();
+		max_skew = std::max(max_skew, a > b ? a - b : b - a);
+	}
+
+	if (shared > 0) {
+		shared--;
+		machine.SharedAccess();
+	}
+}
+
+
+
+int main() {
+	// CPU 0: loop OUT (10),A / JR loop, 23 T-states. CPU 1: NOPs.
+	static const ZBYTE code[] = { 0xd3, 0x10, 0x18, 0xfc };
+	memcpy(memory[0], code, sizeof(code));
+
+	for (int i = 0; i < 2; i++) {
+		cpu[i].memory = memory[i];
+		cpu[i].Reset();
+		machine.Add(&cpu[i]);
+	}
+	cpu[0].SetIOWriteCallback(Out);
+	machine.SetQuantum(QUANTUM);
+	machine.SetMinQuantum(MIN_QUANTUM);
+
+	// Round-robin: exact end clocks, skew within a quantum
+	machine.Run(100000);
+	Expect(machine.GetTime() == 100000, "Machine time off");
+	Expect(cpu[0].GetClock() == 100000 && cpu[1].GetClock() == 100000, "CPUs didn't stop at the machine time");
+	Expect(max_skew > 0 && max_skew <= QUANTUM, "CPUs drifted more than a quantum apart");
+
+	// A shared access shrinks the next quantum, not the current one
+	shared = 1;
+	ZQWORD before = machine.GetTime();
+	machine.Run(QUANTUM);
+	Expect(machine.GetTime() - before == QUANTUM, "Shared access cut the current quantum");
+	Expect(machine.GetCurrentQuantum() == MIN_QUANTUM, "Next quantum didn't drop to the minimum");
+
+	// Then doubles back up to the configured size
+	unsigned int expected = MIN_QUANTUM;
+	bool doubled = true;
+	while (expected < QUANTUM) {
+		machine.Run(machine.GetCurrentQuantum());
+		expected = std::min(expected * 2, (unsigned int) QUANTUM);
+		doubled &= machine.GetCurrentQuantum() == expected;
+	}
+	Expect(doubled, "Quantum didn't double back up");
+
+	// A shared access in every quantum keeps it at the minimum
+	shared = 1000;
+	machine.Run(10 * QUANTUM);
+	Expect(machine.GetCurrentQuantum() == MIN_QUANTUM, "Contended quantum grew");
+	shared = 0;
+
+	// Threaded, the same end clocks
+	measure = false;
+	machine.SetThreaded(true);
+	ZQWORD end = machine.GetTime() + 100000;
+	machine.Run(100000);
+	machine.SetThreaded(false);
+	Expect(cpu[0].GetClock() == end && cpu[1].GetClock() == end, "Threaded CPUs didn't stop at the machine time");
+
+	// CPU 1 waiting on an IN, round-robin then threaded
+	memset(memory[1], 0xdb, sizeof(Z80ADDRESSBUS));		// IN A, (DB) all over
+	cpu[1].SetIOReadAsyncCallback([](ZWORD, ZBYTE &value) {
+		value = 0;
+		return !hold;
+	});
+	for (int threaded = 0; threaded < 2; threaded++) {
+		machine.SetThreaded(threaded);
+		hold = true;
+		before = machine.GetTime();
+		ZQWORD ran = machine.Run(100000);
+		Expect(ran < 100000 && machine.GetTime() == before + ran, "Run() didn't stop after the suspended IN");
+		Expect(cpu[1].isSuspended() && cpu[0].GetClock() == machine.GetTime() && cpu[1].GetClock() < machine.GetTime(),
+			"Suspended CPU didn't stay behind");
+		hold = false;
+		cpu[1].ResumeIO(0);
+		end = before + 100000;
+		machine.Run(end - machine.GetTime());
+		Expect(cpu[0].GetClock() == end && cpu[1].GetClock() == end, "Resumed CPU didn't catch up");
+	}
+	machine.SetThreaded(false);
+
+	printf("MAX SKEW: %llu T-states\n", (unsigned long long) max_skew);
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80.h"
+#include "z80pacer.h"
+#include "expect.h"
+
+
+// Z80Pacer against CLOCK_MONOTONIC at 1 MHz. Pace() must never return
+// before the wall clock reaches the CPU clock; a late slice within the max
+// lag is paid back, a longer stall resyncs instead; turbo never waits and
+// rebases when switched off; a halted CPU sleeps instead of spinning.
+// Bounds are loose on the slow side, the machine may be busy.
+// pacer
+
+
+#define HZ			1000000
+#define SLICE		10000			// 10 ms
+#define SLICES		20
+#define SLACK_NS	5000000ULL
+
+
+static Z80ADDRESSBUS memory;
+static Z80 cpu;
+
+
+
+static ZQWORD Now(clockid_t id = CLOCK_MONOTONIC) {
+	struct timespec ts;
+	clock_gettime(id, &ts);
+	return (ZQWORD) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+
+static void Sleep(ZQWORD ns) {
+	struct timespec ts;
+	ts.tv_sec = ns / 1000000000ULL;
+	ts.tv_nsec = ns % 1000000000ULL;
+	nanosleep(&ts, nullptr);
+}
+
+
+
+// Wall time the CPU clock stands for since the pacer was synced
+static ZQWORD Emulated(ZQWORD since) {
+	return (cpu.GetClock() - since) * 1000;
+}
+
+
+
+int main() {
+	cpu.memory = memory;		// All NOPs
+	cpu.Reset();
+
+	// Steady pacing, never ahead of the wall clock. Each start is taken
+	// before the pacer syncs, so it can only make the wall time longer.
+	ZQWORD start = Now();
+	Z80Pacer pacer(&cpu, HZ);
+	ZQWORD clock = cpu.GetClock();
+	bool ahead = false;
+	for (int i = 0; i < SLICES; i++) {
+		pacer.Run(SLICE);
+		ahead |= Now() - start < Emulated(clock);
+	}
+	ZQWORD wall = Now() - start;
+	Expect(!ahead, "Pace() returned before its deadline");
+	Expect(wall < Emulated(clock) + SLACK_NS, "Steady pacing ran slow");
+	Expect(pacer.GetStats().waits + pacer.GetStats().late == SLICES, "Stats miss Pace() calls");
+	Expect(pacer.GetStats().min_error <= pacer.GetStats().max_error, "Wake error min above max");
+
+	// A 20 ms hiccup within the max lag is paid back by the next slices
+	pacer.ClearStats();
+	pacer.SetMaxLag(50000000);
+	start = Now();
+	pacer.Resync();
+	clock = cpu.GetClock();
+	for (int i = 0; i < SLICES; i++) {
+		if (i == 5) {
+			Sleep(20000000);
+		}
+		pacer.Run(SLICE);
+	}
+	wall = Now() - start;
+	Expect(pacer.GetStats().late > 0, "Hiccup didn't make a slice late");
+	Expect(pacer.GetStats().resyncs == 0, "Hiccup within the max lag resynced");
+	Expect(wall >= Emulated(clock) && wall < Emulated(clock) + SLACK_NS, "Hiccup wasn't paid back");
+
+	// A 100 ms stall beyond the max lag resyncs, the lost time is not caught up
+	pacer.ClearStats();
+	start = Now();
+	pacer.Resync();
+	clock = cpu.GetClock();
+	for (int i = 0; i < SLICES; i++) {
+		if (i == 5) {
+			Sleep(100000000);
+		}
+		pacer.Run(SLICE);
+	}
+	wall = Now() - start;
+	Expect(pacer.GetStats().resyncs == 1, "Stall beyond the max lag didn't resync");
+	Expect(wall >= Emulated(clock) + 100000000 - SLICE * 1000, "Resync tried to catch up");
+
+	// Turbo, a second of CPU time never waits; switched off, pacing restarts from now
+	pacer.ClearStats();
+	pacer.SetTurbo(true);
+	start = Now();
+	for (int i = 0; i < HZ / SLICE; i++) {
+		pacer.Run(SLICE);
+	}
+	Expect(Now() - start < 1000000000ULL / 2 && pacer.GetStats().waits == 0, "Turbo waited");
+	start = Now();
+	pacer.SetTurbo(false);
+	clock = cpu.GetClock();
+	for (int i = 0; i < SLICES; i++) {
+		pacer.Run(SLICE);
+	}
+	wall = Now() - start;
+	Expect(wall >= Emulated(clock) && wall < Emulated(clock) + SLACK_NS, "Turbo off didn't rebase");
+
+	// Halted, the pacer sleeps: little CPU time for the wall time
+	memory[0] = 0x76;		// HALT
+	cpu.Reset();
+	start = Now();
+	pacer.Resync();
+	ZQWORD cpu_start = Now(CLOCK_PROCESS_CPUTIME_ID);
+	for (int i = 0; i < SLICES; i++) {
+		pacer.Run(SLICE);
+	}
+	wall = Now() - start;
+	ZQWORD used = Now(CLOCK_PROCESS_CPUTIME_ID) - cpu_start;
+	Expect(cpu.isHalted(), "CPU didn't halt");
+	Expect(used < wall / 2, "Halted CPU spun instead of sleeping");
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "z80.h"
+#include "z80ports.h"
+
+
+// OUT rate benchmark: Z80Ports rings against a mutex-protected queue.
+//
+// The CPU runs "loop: OUT (0x10),A / INC A / JR loop", an OUT every 27
+// T-states, while a device thread drains the writes as fast as it can.
+// portbench [tstates]
+
+
+#define BENCH_PORT		0x10
+#define BENCH_TSTATES	200000000
+
+
+static Z80ADDRESSBUS memory;
+
+
+
+static void LoadProgram(Z80 *cpu) {
+	memset(memory, 0, sizeof(memory));
+
+	memory[0] = 0xd3;	// OUT (0x10), A
+	memory[1] = BENCH_PORT;
+	memory[2] = 0x3c;	// INC A
+	memory[3] = 0x18;	// JR -5
+	memory[4] = 0xfb;
+
+	cpu->memory = memory;
+	cpu->Reset();
+}
+
+
+
+static void Report(const char *name, double seconds, ZQWORD outs, ZQWORD received, ZQWORD dropped) {
+	printf("%-8s %8.3f s  %12.0f OUT/s  received %llu  dropped %llu\n", name, seconds,
+		outs / seconds, (unsigned long long) received, (unsigned long long) dropped);
+}
+
+
+
+static void BenchMutex(unsigned int tstates) {
+	Z80 cpu;
+	std::mutex lock;
+	std::deque<Z80IOEVENT> queue;
+	std::atomic<bool> done(false);
+	ZQWORD outs = 0, received = 0;
+
+	LoadProgram(&cpu);
+	cpu.SetIOWriteCallback([&](ZWORD port, ZBYTE value) {
+		Z80IOEVENT ev;
+		ev.tstate = cpu.GetClock();
+		ev.port = port;
+		ev.value = value;
+
+		std::lock_guard<std::mutex> guard(lock);
+		queue.push_back(ev);
+		outs++;
+	});
+
+	std::thread device([&]() {
+		while (true) {
+			bool last = done.load();
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				received += queue.size();
+				queue.clear();
+			}
+			if (last) {
+				break;
+			}
+			std::this_thread::yield();
+		}
+	});
+
+	auto start = std::chrono::steady_clock::now();
+	cpu.ExecuteTStates(tstates);
+	auto end = std::chrono::steady_clock::now();
+
+	done.store(true);
+	device.join();
+
+	Report("mutex", std::chrono::duration<double>(end - start).count(), outs, received, 0);
+}
+
+
+
+static void BenchRing(unsigned int tstates) {
+	Z80 cpu;
+	std::atomic<bool> done(false);
+	ZQWORD outs, received = 0;
+
+	LoadProgram(&cpu);
+
+	Z80Ports ports(&cpu);
+	int device_id = ports.AddDevice(65536, Z80PORTS_BLOCK);
+	ports.Route(BENCH_PORT, device_id);
+
+	std::thread device([&]() {
+		Z80IOEVENT ev;
+		while (true) {
+			bool last = done.load();
+			while (ports.Pop(device_id, ev)) {
+				received++;
+			}
+			if (last) {
+				break;
+			}
+			std::this_thread::yield();
+		}
+	});
+
+	auto start = std::chrono::steady_clock::now();
+	cpu.ExecuteTStates(tstates);
+	auto end = std::chrono::steady_clock::now();
+
+	done.store(true);
+	device.join();
+
+	outs = received + ports.Dropped(device_id);
+	Report("spsc", std::chrono::duration<double>(end - start).count(), outs, received, ports.Dropped(device_id));
+}
+
+
+
+int main(int argc, char *argv[]) {
+	unsigned int tstates = argc > 1 ? strtoul(argv[1], nullptr, 10) : BENCH_TSTATES;
+
+	BenchMutex(tstates);
+	BenchRing(tstates);
+
+	return 0;
+}
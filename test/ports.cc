@@ -0,0 +1,184 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "z80.h"
+#include "z80ports.h"
+#include "expect.h"
+
+
+// Z80Ports with a ring too small for the OUTs of a run, under each full
+// ring policy: blocking delivers every write in order once the device
+// thread drains, the synchronous fallback gets the overflow on the CPU
+// thread, dropping loses exactly the overflow.
+// ports
+
+
+#define RING	4
+#define WRITES	10
+#define PORT	0x10
+
+
+static Z80ADDRESSBUS memory;
+static std::vector<ZBYTE> received;
+static std::vector<ZBYTE> fallback;
+
+
+
+static void Fallback(const Z80IOEVENT &ev) {
+	fallback.push_back(ev.value);
+}
+
+
+
+// loop: OUT (10),A / INC A / JR loop, 27 T-states an OUT, A from 0
+
+static void Run(Z80 *cpu) {
+	static const ZBYTE code[] = { 0xd3, PORT, 0x3c, 0x18, 0xfb };
+	memset(memory, 0, sizeof(memory));
+	memcpy(memory, code, sizeof(code));
+	cpu->memory = memory;
+	cpu->Reset();
+
+	Z80STATE state;
+	cpu->SaveState(&state, false);
+	state.af = 0;
+	cpu->LoadState(&state, false);
+
+	cpu->ExecuteTStates(27 * WRITES);
+}
+
+
+
+static bool InOrder(const std::vector<ZBYTE> &values, ZBYTE first) {
+	for (size_t i = 0; i < values.size(); i++) {
+		if (values[i] != (ZBYTE) (first + i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+
+static void Drain(Z80Ports *ports, int device) {
+	Z80IOEVENT ev;
+	received.clear();
+	while (ports->Pop(device, ev)) {
+		received.push_back(ev.value);
+	}
+}
+
+
+
+static void Drop() {
+	Z80 cpu;
+	Z80Ports ports(&cpu);
+	int device = ports.AddDevice(RING, Z80PORTS_DROP);
+	ports.Route(PORT, device);
+
+	Run(&cpu);
+	Drain(&ports, device);
+
+	Expect(received.size() == RING && InOrder(received, 0), "Drop: ring contents wrong");
+	Expect(ports.Dropped(device) == WRITES - RING && ports.Overflows(device) == WRITES - RING, "Drop: overflow not counted");
+}
+
+
+
+static void Sync() {
+	Z80 cpu;
+	Z80Ports ports(&cpu);
+	int device = ports.AddDevice(RING, Z80PORTS_SYNC, Fallback);
+	ports.Route(PORT, device);
+
+	fallback.clear();
+	Run(&cpu);
+	Drain(&ports, device);
+
+	Expect(received.size() == RING && InOrder(received, 0), "Sync: ring contents wrong");
+	Expect(fallback.size() == WRITES - RING && InOrder(fallback, RING), "Sync: fallback didn't get the overflow");
+	Expect(ports.Dropped(device) == 0 && ports.Overflows(device) == WRITES - RING, "Sync: overflow miscounted");
+}
+
+
+
+// Nothing drains the ring: by default the CPU drops what doesn't fit rather
+// than waiting for a device thread
+
+static void Default() {
+	Z80 cpu;
+	Z80Ports ports(&cpu);
+	int device = ports.AddDevice(RING);
+	ports.Route(PORT, device);
+
+	Run(&cpu);
+	Drain(&ports, device);
+
+	Expect(received.size() == RING && InOrder(received, 0), "Default: ring contents wrong");
+	Expect(ports.Dropped(device) == WRITES - RING, "Default: overflow not dropped");
+}
+
+
+
+// The device thread only starts draining once the CPU must have filled the
+// ring
+
+static void Block() {
+	Z80 cpu;
+	Z80Ports ports(&cpu);
+	int device = ports.AddDevice(RING, Z80PORTS_BLOCK);
+	ports.Route(PORT, device);
+
+	received.clear();
+	std::thread consumer([&ports, device]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		Z80IOEVENT ev;
+		while (received.size() < WRITES) {
+			if (ports.Pop(device, ev)) {
+				received.push_back(ev.value);
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	Run(&cpu);
+	consumer.join();
+
+	Expect(received.size() == WRITES && InOrder(received, 0), "Block: writes lost or reordered");
+	Expect(ports.Dropped(device) == 0 && ports.Overflows(device) > 0, "Block: overflow miscounted");
+}
+
+
+
+int main() {
+	Drop();
+	Sync();
+	Default();
+	Block();
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
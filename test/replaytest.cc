@@ -0,0 +1,185 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "z80.h"
+#include "z80record.h"
+
+
+// Records a program reading ports fed from a pseudo random source, with a
+// frame interrupt held for 32 T-states, the odd NMI and WAIT stalls, then
+// replays the stream on a CPU restored to the starting state with no
+// devices. Both runs must end in the same state.
+// replaytest [frames]
+
+
+#define REPLAY_FRAME	69888
+#define REPLAY_FRAMES	500
+
+
+static const ZBYTE boot[] = {
+	0xf3,					// DI
+	0x31, 0x00, 0xf0,		// LD SP, 0xF000
+	0xed, 0x56,				// IM 1
+	0xfb,					// EI
+	0xc3, 0x00, 0x01,		// JP 0x0100
+};
+
+// IM 1 handler at 0x0038
+static const ZBYTE irq_handler[] = {
+	0xf5,					// PUSH AF
+	0xdb, 0xfe,				// IN A, (0xFE)
+	0x32, 0x00, 0x80,		// LD (0x8000), A
+	0xf1,					// POP AF
+	0xfb,					// EI
+	0xed, 0x4d,				// RETI
+};
+
+// At 0x0066
+static const ZBYTE nmi_handler[] = {
+	0xf5,					// PUSH AF
+	0x3a, 0x01, 0x80,		// LD A, (0x8001)
+	0x3c,					// INC A
+	0x32, 0x01, 0x80,		// LD (0x8001), A
+	0xf1,					// POP AF
+	0xed, 0x45,				// RETN
+};
+
+// At 0x0100
+static const ZBYTE program[] = {
+	0x21, 0x00, 0x90,		// LD HL, 0x9000
+	// loop:
+	0xdb, 0x1f,				// IN A, (0x1F)
+	0x86,					// ADD A, (HL)
+	0x77,					// LD (HL), A
+	0x2c,					// INC L
+	0x0e, 0x7f,				// LD C, 0x7F
+	0xed, 0x40,				// IN B, (C)
+	0x78,					// LD A, B
+	0xae,					// XOR (HL)
+	0x77,					// LD (HL), A
+	0x2c,					// INC L
+	0x7d,					// LD A, L
+	0xe6, 0x3f,				// AND 0x3F
+	0x20, 0xee,				// JR NZ, loop
+	0x76,					// HALT
+	0x18, 0xeb,				// JR loop
+};
+
+
+static Z80ADDRESSBUS memory, replay_memory;
+static Z80STATE start, recorded, replayed;
+static unsigned int seed = 12345;
+
+
+
+static unsigned int Random() {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int frames = argc > 1 ? atoi(argv[1]) : REPLAY_FRAMES;
+
+	memset(memory, 0, sizeof(memory));
+	memcpy(&memory[0x0000], boot, sizeof(boot));
+	memcpy(&memory[0x0038], irq_handler, sizeof(irq_handler));
+	memcpy(&memory[0x0066], nmi_handler, sizeof(nmi_handler));
+	memcpy(&memory[0x0100], program, sizeof(program));
+
+	Z80 cpu;
+	cpu.memory = memory;
+	cpu.SetIOReadCallback([](ZWORD) { return (ZBYTE) Random(); });
+	cpu.Reset();
+	cpu.SaveState(&start);
+
+	Z80Recorder recorder;
+	recorder.Start(&cpu);
+
+	auto begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < frames; i++) {
+		cpu.IRQ();
+		cpu.ExecuteTStates(32);
+		cpu.ClearIRQ();
+
+		unsigned int mid = 32 + Random() % (REPLAY_FRAME - 64);
+		cpu.ExecuteTStates(mid - 32);
+		if (Random() % 7 == 0) {
+			cpu.NMI();
+		}
+		if (Random() % 3 == 0) {
+			cpu.Wait(Random() % 12 + 1);
+		}
+		cpu.ExecuteTStates(REPLAY_FRAME - mid);
+	}
+	double record_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	recorder.Stop();
+	cpu.SaveState(&recorded);
+
+	const std::vector<ZBYTE> &stream = recorder.GetStream();
+
+	// Replay in slices that have nothing to do with the recorded frames
+	Z80 replay;
+	replay.memory = replay_memory;
+	replay.LoadState(&start);
+	Z80Replayer replayer(&replay, stream.data(), stream.size());
+
+	begin = std::chrono::steady_clock::now();
+	for (ZQWORD left = (ZQWORD) frames * REPLAY_FRAME; left; ) {
+		unsigned int ts = left < 10007 ? (unsigned int) left : 10007;
+		replayer.ExecuteTStates(ts);
+		left -= ts;
+	}
+	double replay_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	replay.SaveState(&replayed);
+
+	// The recorded run may end with INT still asserted, the replay drops it
+	// on every acknowledge
+	recorded.events &= ~Z80EVENT_INT;
+	replayed.events &= ~Z80EVENT_INT;
+
+	int failed = 0;
+	if (memcmp(&recorded, &replayed, sizeof(Z80STATE))) {
+		printf("Replayed state differs from the recorded run\n");
+		failed++;
+	}
+	if (replayer.GetMismatches()) {
+		printf("%llu mismatched events\n", replayer.GetMismatches());
+		failed++;
+	}
+	if (!replayer.Finished()) {
+		printf("Stream not used up\n");
+		failed++;
+	}
+
+	printf("%llu events in %zu bytes (%.2f bytes each)\n", recorder.GetEvents(), stream.size(),
+		(double) stream.size() / recorder.GetEvents());
+	printf("Recorded in %.3f s, replayed in %.3f s\n", record_time, replay_time);
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "z80.h"
+#include "z80rewind.h"
+#include "zexfixture.h"
+
+
+// Z80Rewind on zexdoc, one checkpoint per 69888 T-state frame. Times the
+// run with and without checkpoints, then seeks back to assorted T-states
+// and checks the CPU ends up exactly as a straight run to the same T-state.
+// rewindtest [program.com] [frames]
+
+
+#define REWIND_FRAME		69888
+#define REWIND_FRAMES		2000
+#define REWIND_CAPACITY		300
+#define REWIND_SEEKS		50
+
+
+static Z80ADDRESSBUS memory, reference_memory;
+static Z80STATE state;
+
+
+
+// Seconds to run frames frames, and of that the time spent in Checkpoint()
+// after each one if rewind is set
+
+static double Run(Z80 *cpu, Z80Rewind *rewind, int frames, double *checkpoints) {
+	auto start = std::chrono::steady_clock::now();
+	*checkpoints = 0;
+
+	for (int i = 0; i < frames; i++) {
+		cpu->ExecuteTStates(REWIND_FRAME);
+		if (rewind) {
+			auto before = std::chrono::steady_clock::now();
+			rewind->Checkpoint();
+			*checkpoints += std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+		}
+	}
+
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+
+int main(int argc, char *argv[]) {
+	const char *filename = argc > 1 ? argv[1] : "./test/zexdoc.com";
+	int frames = argc > 2 ? atoi(argv[2]) : REWIND_FRAMES;
+
+	Z80 plain_cpu, cpu;
+	plain_cpu.memory = memory;
+	cpu.memory = memory;
+
+	if (!LoadZex(filename, memory)) {
+		return 1;
+	}
+	plain_cpu.Reset();
+	double overhead;
+	double plain = Run(&plain_cpu, nullptr, frames, &overhead);
+
+	LoadZex(filename, memory);
+	cpu.Reset();
+	Z80Rewind rewind(&cpu, REWIND_CAPACITY);
+	rewind.Checkpoint();
+	double checkpointed = Run(&cpu, &rewind, frames, &overhead);
+
+	printf("%d frames: %.3f s plain, %.3f s with checkpoints\n", frames, plain, checkpointed);
+	printf("Checkpoint() %.2f us, %.2f%% of the run\n", overhead * 1e6 / frames, overhead * 100 / checkpointed);
+	printf("%u checkpoints, %llu bytes stored\n", rewind.GetCheckpoints(), rewind.GetBytes());
+
+	// Targets in ascending order, so one straight run gives all the expected
+	// states. Later seeks drop the newer checkpoints, so seek from the last.
+	ZQWORD oldest = rewind.GetOldest();
+	ZQWORD span = cpu.GetClock() - oldest;
+	std::vector<ZQWORD> targets;
+	std::vector<Z80STATE> expected(REWIND_SEEKS);
+
+	for (int i = 0; i < REWIND_SEEKS; i++) {
+		targets.push_back(oldest + span * i / REWIND_SEEKS + (i * 7919) % REWIND_FRAME);
+	}
+
+	Z80 reference;
+	reference.memory = reference_memory;
+	LoadZex(filename, reference_memory);
+	reference.Reset();
+	for (int i = 0; i < REWIND_SEEKS; i++) {
+		for (ZQWORD left = targets[i] - reference.GetClock(); left; ) {
+			unsigned int ts = left < REWIND_FRAME ? (unsigned int) left : REWIND_FRAME;
+			reference.ExecuteTStates(ts);
+			left -= ts;
+		}
+		reference.SaveState(&expected[i]);
+	}
+
+	int failed = 0;
+	for (int i = REWIND_SEEKS - 1; i >= 0; i--) {
+		if (rewind.Seek(targets[i])) {
+			printf("Seek to %llu refused\n", targets[i]);
+			failed++;
+			continue;
+		}
+		cpu.SaveState(&state);
+
+		if (memcmp(&state, &expected[i], sizeof(Z80STATE))) {
+			printf("Seek to %llu: state differs from a straight run\n", targets[i]);
+			failed++;
+		}
+	}
+
+	if (rewind.Seek(oldest - 1) == 0) {
+		printf("Seek before the oldest checkpoint accepted\n");
+		failed++;
+	}
+
+	printf("SEEKS: %d\nFAILED SEEKS: %d\n", REWIND_SEEKS, failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "z80.h"
+#include "z80record.h"
+#include "z80runahead.h"
+
+
+// Run-ahead on a program with one frame of lag: its frame interrupt draws
+// the state computed the frame before, then reads input into the state.
+// For 0 to 3 frames ahead, reports how many frames a change of input takes
+// to show and what run-ahead costs per frame, and checks the real CPU ends
+// up exactly as without run-ahead, with the same recording, interrupt counts
+// and dirty pages: the speculative frames must not reach the recorder or the
+// stats, nor leave pages dirty behind them.
+// runahead [frames]
+
+
+#define RUNAHEAD_FRAME		69888
+#define RUNAHEAD_FRAMES		600
+#define RUNAHEAD_INPUT		10		// Frames between input changes
+
+
+static const ZBYTE boot[] = {
+	0xf3,					// DI
+	0x31, 0x00, 0xf0,		// LD SP, 0xF000
+	0xed, 0x56,				// IM 1
+	0xfb,					// EI
+	0x76,					// HALT
+	0x18, 0xfd,				// JR -3
+};
+
+// IM 1 handler at 0x0038
+static const ZBYTE handler[] = {
+	0xf5,					// PUSH AF
+	0x3a, 0x01, 0x80,		// LD A, (0x8001)
+	0x32, 0x00, 0x40,		// LD (0x4000), A		Draw last frame's state
+	0xdb, 0xfe,				// IN A, (0xFE)
+	0x32, 0x01, 0x80,		// LD (0x8001), A		Update it
+	0xd3, 0xfe,				// OUT (0xFE), A
+	0xf1,					// POP AF
+	0xfb,					// EI
+	0xed, 0x4d,				// RETI
+};
+
+
+static Z80ADDRESSBUS memory;
+static Z80STATE plain_state, state;
+static std::vector<ZBYTE> plain_stream, stream;
+static Z80IRQSTATS plain_irqs, irqs;
+
+
+
+// Returns the average frames from an input change to the frame showing it
+
+static double Run(unsigned int ahead, int frames, Z80STATE *end, Z80RUNAHEADSTATS *stats, ZQWORD *writes,
+	std::vector<ZBYTE> *recorded, Z80IRQSTATS *irq, ZQWORD *dirty) {
+	memset(memory, 0, sizeof(memory));
+	memcpy(&memory[0x0000], boot, sizeof(boot));
+	memcpy(&memory[0x0038], handler, sizeof(handler));
+
+	Z80 cpu;
+	ZBYTE input = 0;
+	ZBYTE shown = 0;
+
+	cpu.memory = memory;
+	cpu.SetIOReadCallback([&input](ZWORD) { return input; });
+	cpu.SetIOWriteCallback([writes](ZWORD, ZBYTE) { (*writes)++; });
+	cpu.SetIRQAckCallback([&cpu]() { cpu.ClearIRQ(); return (ZBYTE) 0xff; });
+	cpu.Reset();
+	cpu.SetIRQStats(irq);
+	*writes = 0;
+	*dirty = 0;
+
+	Z80Recorder recorder;
+	recorder.Start(&cpu);
+
+	Z80RunAhead runahead(&cpu, RUNAHEAD_FRAME, ahead);
+	runahead.SetFrameCallback([](Z80 *cpu) { cpu->IRQ(); });
+	runahead.SetPresentCallback([&shown](Z80 *cpu) { shown = cpu->memory[0x4000]; });
+
+	int changes = 0;
+	int lag = 0;
+	int changed_at = -1;
+
+	for (int i = 0; i < frames; i++) {
+		if (i % RUNAHEAD_INPUT == 0) {
+			input = i / RUNAHEAD_INPUT + 1;
+			changed_at = i;
+		}
+
+		runahead.Frame();
+
+		ZQWORD pages[4] = {};
+		cpu.TakeDirtyPages(pages);
+		for (int word = 0; word < 4; word++) {
+			*dirty += __builtin_popcountll(pages[word]);
+		}
+
+		if (changed_at >= 0 && shown == input) {
+			lag += i - changed_at;
+			changes++;
+			changed_at = -1;
+		}
+	}
+
+	recorder.Stop();
+	cpu.SetIRQStats(nullptr);
+	*recorded = recorder.GetStream();
+
+	cpu.SaveState(end);
+	*stats = runahead.GetStats();
+
+	return changes ? (double) lag / changes : -1;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int frames = argc > 1 ? atoi(argv[1]) : RUNAHEAD_FRAMES;
+	Z80RUNAHEADSTATS stats;
+	ZQWORD writes;
+	ZQWORD plain_dirty, dirty;
+	int failed = 0;
+
+	Run(0, frames, &plain_state, &stats, &writes, &plain_stream, &plain_irqs, &plain_dirty);
+
+	printf("Ahead  Lag (frames)  Frame us  Ahead us  State us  Cost\n");
+	for (unsigned int ahead = 0; ahead <= 3; ahead++) {
+		double lag = Run(ahead, frames, &state, &stats, &writes, &stream, &irqs, &dirty);
+
+		printf("%5u  %12.2f  %8.2f  %8.2f  %8.2f  %+5.0f%%\n", ahead, lag,
+			stats.total_frame_ns / 1000.0 / stats.frames,
+			stats.total_ahead_ns / 1000.0 / stats.frames,
+			stats.total_state_ns / 1000.0 / stats.frames,
+			(stats.total_ahead_ns + stats.total_state_ns) * 100.0 / stats.total_frame_ns);
+
+		if (memcmp(&state, &plain_state, sizeof(Z80STATE))) {
+			printf("Real CPU differs from the run without run-ahead\n");
+			failed++;
+		}
+		if (stream != plain_stream || memcmp(&irqs, &plain_irqs, sizeof(Z80IRQSTATS))) {
+			printf("Speculative frames reached the recorder or the interrupt stats\n");
+			failed++;
+		}
+		if (dirty != plain_dirty) {
+			printf("%llu pages reported dirty, expected %llu\n", dirty, plain_dirty);
+			failed++;
+		}
+		if (writes != (ZQWORD) frames) {
+			printf("%llu port writes reached the device, expected %d\n", writes, frames);
+			failed++;
+		}
+		if (ahead && lag != 0) {
+			printf("Input still lags with %u frames ahead\n", ahead);
+			failed++;
+		}
+	}
+
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80.h"
+#include "z80runner.h"
+#include "expect.h"
+
+
+// Z80Runner: cycle and I/O quotas end jobs within a slice of their limit,
+// a halted job is parked until Wake() and the function given to it runs
+// first, and a worker out of jobs steals from another one.
+// runner
+
+
+#define JOBS		4
+#define SLICE		1000
+#define OUT_LOOP	23		// T-states per OUT of the loop program
+#define LONG_RUN	5000000
+#define SHORT_RUN	10000
+
+
+static Z80ADDRESSBUS memory[JOBS];
+static Z80 cpus[JOBS];
+
+
+
+static void Out(ZWORD, ZBYTE) {
+}
+
+
+
+static void RaiseNMI(Z80 *cpu) {
+	cpu->NMI();
+}
+
+
+
+// loop: OUT (10),A / JR loop. Or DI / HALT / HALT, with an NMI handler
+// doing one OUT before RETN.
+
+static Z80 *Load(int n, bool halt) {
+	static const ZBYTE loop[] = { 0xd3, 0x10, 0x18, 0xfc };
+	static const ZBYTE park[] = { 0xf3, 0x76, 0x76 };
+	static const ZBYTE nmi[] = { 0xd3, 0x10, 0xed, 0x45 };
+
+	memset(memory[n], 0, sizeof(memory[n]));
+	if (halt) {
+		memcpy(memory[n], park, sizeof(park));
+		memcpy(memory[n] + 0x66, nmi, sizeof(nmi));
+	} else {
+		memcpy(memory[n], loop, sizeof(loop));
+	}
+
+	cpus[n].memory = memory[n];
+	cpus[n].SetIOWriteCallback(Out);
+	cpus[n].Reset();
+
+	return &cpus[n];
+}
+
+
+
+static void Quotas() {
+	Z80Runner runner(1);
+	int cycles = runner.Add(Load(0, false), SLICE, 100000);
+	int io = runner.Add(Load(1, false), SLICE, 0, 100);
+	runner.Start();
+	runner.Wait();
+
+	Z80JOBSTATS stats = runner.GetStats(cycles);
+	Expect(stats.state == Z80JOB_DONE, "Cycle quota didn't end the job");
+	Expect(stats.tstates >= 100000 && stats.tstates < 100000 + OUT_LOOP, "Cycle quota overrun");
+	Expect(stats.slices == 100000 / SLICE, "Cycle quota took extra slices");
+
+	// Checked at slice boundaries, a slice can't hold more than SLICE / 11 I/O cycles
+	stats = runner.GetStats(io);
+	Expect(stats.state == Z80JOB_DONE, "I/O quota didn't end the job");
+	Expect(stats.io >= 100 && stats.io < 100 + SLICE / 11, "I/O quota overrun");
+}
+
+
+
+static void Parking() {
+	Z80Runner runner(2);
+	int id = runner.Add(Load(0, true), SLICE);
+	runner.Start();
+	runner.Wait();
+
+	Z80JOBSTATS stats = runner.GetStats(id);
+	Expect(stats.state == Z80JOB_PARKED, "Halted job not parked");
+	Expect(stats.slices == 1 && stats.io == 0, "Parked job kept running");
+
+	runner.Wake(id, RaiseNMI);
+	runner.Wait();
+	stats = runner.GetStats(id);
+	Expect(stats.state == Z80JOB_PARKED, "Woken job not parked again");
+	Expect(stats.slices == 2 && stats.io == 1, "Wake() function didn't run before the slice");
+
+	// Nothing to do, stays parked
+	runner.Wake(id);
+	runner.Wait();
+	stats = runner.GetStats(id);
+	Expect(stats.state == Z80JOB_PARKED && stats.io == 1, "Empty wake misbehaved");
+}
+
+
+
+// Jobs go round robin, so the first worker gets the long ones and the second
+// runs out of work early
+
+static void Stealing() {
+	Z80Runner runner(2);
+	int ids[JOBS];
+	for (int i = 0; i < JOBS; i++) {
+		ids[i] = runner.Add(Load(i, false), SLICE, i % 2 ? SHORT_RUN : LONG_RUN);
+	}
+	runner.Start();
+	runner.Wait();
+
+	ZQWORD steals = 0;
+	for (int i = 0; i < JOBS; i++) {
+		Z80JOBSTATS stats = runner.GetStats(ids[i]);
+		Expect(stats.state == Z80JOB_DONE, "Job not finished");
+		Expect(stats.tstates >= (i % 2 ? SHORT_RUN : LONG_RUN), "Job stopped short");
+		steals += stats.steals;
+	}
+	Expect(steals > 0, "Idle worker didn't steal");
+}
+
+
+
+int main() {
+	Quotas();
+	Parking();
+	Stealing();
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "z80.h"
+#include "z80runner.h"
+#include "zexfixture.h"
+
+
+// Z80Runner scaling on zexdoc. The same set of instances runs for a fixed
+// cycle quota each with 1, 2, 4... workers up to the number of cores; the
+// throughput of every pool size is reported against the single worker one.
+// Every run must leave each instance in the same state.
+// runnerbench [instances] [tstates] [program.com]
+
+
+#define BENCH_INSTANCES	64
+#define BENCH_TSTATES	20000000
+#define BENCH_SLICE		20000
+
+
+static Z80ADDRESSBUS program;
+
+
+
+// Runs every instance from the start, returns the seconds it took and
+// leaves the final states in states
+
+static double Run(unsigned int threads, int instances, ZQWORD tstates, std::vector<Z80STATE> &states) {
+	std::vector<Z80 *> cpus;
+	std::vector<ZBYTE *> memories;
+
+	for (int i = 0; i < instances; i++) {
+		ZBYTE *memory = new Z80ADDRESSBUS;
+		memcpy(memory, program, sizeof(program));
+		Z80 *cpu = new Z80;
+		cpu->memory = memory;
+		cpu->Reset();
+		cpus.push_back(cpu);
+		memories.push_back(memory);
+	}
+
+	Z80Runner runner(threads);
+	for (int i = 0; i < instances; i++) {
+		runner.Add(cpus[i], BENCH_SLICE, tstates);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	runner.Start();
+	runner.Wait();
+	auto end = std::chrono::steady_clock::now();
+	runner.Stop();
+
+	states.resize(instances);
+	for (int i = 0; i < instances; i++) {
+		cpus[i]->SaveState(&states[i]);
+		delete cpus[i];
+		delete[] memories[i];
+	}
+
+	return std::chrono::duration<double>(end - start).count();
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int instances = argc > 1 ? atoi(argv[1]) : BENCH_INSTANCES;
+	ZQWORD tstates = argc > 2 ? strtoull(argv[2], NULL, 10) : BENCH_TSTATES;
+	const char *filename = argc > 3 ? argv[3] : "./test/zexdoc.com";
+
+	if (!LoadZex(filename, program)) {
+		return 1;
+	}
+
+	unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+	std::vector<Z80STATE> reference, states;
+	double single = 0;
+	int failed = 0;
+
+	printf("%d instances, %llu T-states each, %u cores\n", instances, (unsigned long long) tstates, cores);
+
+	for (unsigned int threads = 1; ; threads = std::min(threads * 2, cores)) {
+		double seconds = Run(threads, instances, tstates, threads == 1 ? reference : states);
+		if (threads == 1) {
+			single = seconds;
+		} else if (memcmp(reference.data(), states.data(), instances * sizeof(Z80STATE))) {
+			printf("%u workers left different states\n", threads);
+			failed++;
+		}
+
+		printf("%3u workers %8.3f s  %9.1f MHz  speedup %5.2f  efficiency %3.0f%%\n", threads, seconds,
+			instances * tstates / seconds / 1e6, single / seconds, 100 * single / seconds / threads);
+
+		if (threads == cores) {
+			break;
+		}
+	}
+
+	printf("FAILED: %d\n", failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
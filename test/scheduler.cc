@@ -0,0 +1,120 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "z80.h"
+#include "z80scheduler.h"
+#include "expect.h"
+
+
+// Z80Scheduler and Z80ClockDomain. Events must fire exactly at their
+// T-state, in time order and, at the same time, in the order they were
+// scheduled; cancelled ones never; periodic ones rescheduling themselves
+// must not drift. Clock conversions must round up to the CPU and down to
+// the device, and survive a day of ticks without overflowing. A CPU
+// suspended on an IN must end Run() early, not hang it.
+// scheduler
+
+
+static Z80ADDRESSBUS memory;		// All NOPs
+static Z80 cpu;
+static Z80Scheduler scheduler(&cpu);
+static std::vector<int> order;
+
+
+
+int main() {
+	cpu.memory = memory;
+	cpu.Reset();
+
+	// Out of order, two pairs at the same time, one cancelled
+	static const ZQWORD times[] = { 500, 100, 300, 100, 7, 300, 250 };
+	int ids[7];
+	for (int i = 0; i < 7; i++) {
+		ZQWORD when = times[i];
+		ids[i] = scheduler.At(when, [i, when](ZQWORD at) {
+			order.push_back(i);
+			Expect(at == when && cpu.GetClock() == when, "Event fired at the wrong T-state");
+		});
+	}
+	scheduler.Cancel(ids[6]);
+	Expect(scheduler.Next() == 7, "Next() isn't the earliest event");
+
+	scheduler.Run(1000);
+	Expect(order == std::vector<int>({4, 1, 3, 2, 5, 0}), "Events fired out of order or cancelled one fired");
+	Expect(cpu.GetClock() == 1000, "Run() didn't stop at its end");
+	Expect(scheduler.Next() == Z80_NEVER, "Events left over");
+
+	// Periodic, rescheduled from its own callback; another one in the past
+	int frames = 0;
+	std::function<void(ZQWORD)> frame = [&](ZQWORD at) {
+		Expect(at == 1000 + (ZQWORD) ++frames * 69888 && cpu.GetClock() == at, "Frame event drifted");
+		scheduler.At(at + 69888, frame);
+	};
+	scheduler.In(69888, frame);
+	bool late = false;
+	scheduler.At(10, [&](ZQWORD) { late = cpu.GetClock() == 1000; });
+	scheduler.Run(69888 * 10);
+	Expect(frames == 10, "Periodic event didn't fire 10 times");
+	Expect(late, "Event in the past didn't fire right away");
+
+	// Clock domains: 3.5 MHz CPU, 44.1 kHz sound chip
+	Z80ClockDomain audio(3500000, 44100);
+	for (ZQWORD t = 0; t < 100000; t++) {
+		ZQWORD cpu_t = audio.ToCPU(t);
+		if (audio.ToDevice(cpu_t) != t || (cpu_t > 0 && audio.ToDevice(cpu_t - 1) >= t)) {
+			Expect(false, "ToCPU() isn't the first T-state of the tick");
+			break;
+		}
+	}
+	ZQWORD day = 44100ULL * 86400 * 365 * 100;		// A century of ticks
+	Expect(audio.ToCPU(day) == 3500000ULL * 86400 * 365 * 100, "ToCPU() overflowed");
+
+	ZQWORD base = cpu.GetClock();
+	ZQWORD tick = audio.ToDevice(base) + 1000;
+	bool fired = false;
+	scheduler.At(audio, tick, [&](ZQWORD at) { fired = at == audio.ToCPU(tick) && cpu.GetClock() == at; });
+	scheduler.Run(200000);
+	Expect(fired, "Device clock event fired at the wrong T-state");
+
+	// A device answering an IN later: Run() must return where the CPU
+	// suspended instead of spinning, and carry on from there after ResumeIO()
+	memset(memory, 0xdb, sizeof(memory));		// IN A, (DB) all over
+	bool hold = true;
+	cpu.SetIOReadAsyncCallback([&](ZWORD, ZBYTE &value) {
+		value = 0;
+		return !hold;
+	});
+	base = cpu.GetClock();
+	fired = false;
+	scheduler.In(500, [&](ZQWORD) { fired = true; });
+	ZQWORD ran = scheduler.Run(1000);
+	Expect(cpu.isSuspended() && ran < 1000 && cpu.GetClock() == base + ran && !fired, "Run() didn't stop at the suspended IN");
+	hold = false;
+	cpu.ResumeIO(0);
+	scheduler.RunUntil(base + 1000);
+	Expect(fired && cpu.GetClock() == base + 1000, "Run() didn't carry on after ResumeIO()");
+	cpu.SetIOReadAsyncCallback(nullptr);
+
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
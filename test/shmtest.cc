@@ -0,0 +1,158 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "z80.h"
+#include "z80shm.h"
+
+
+// Z80SharedState with an observer thread taking snapshots while the
+// emulation thread runs slices back to back. The program counts in A and
+// stores it to two pages in turn, so a snapshot mixing two publications
+// (registers from one, a page from another) breaks the relation between
+// the three. Snapshots must all be consistent and hardly ever run out of
+// retries; at the end the shared copy must equal the CPU's memory. The
+// CPU must keep running once the region is closed or destroyed.
+// shmtest [snapshots]
+
+
+#define SHM_SLICE		1000		// T-states per Execute call
+#define SHM_SNAPSHOTS	20000
+#define SHM_LOW			0x4000
+#define SHM_HIGH		0xc000
+
+
+static const ZBYTE program[] = {
+	0x3c,					// loop: INC A
+	0x32, 0x00, 0x40,		// LD (0x4000), A
+	0x32, 0x00, 0xc0,		// LD (0xC000), A
+	0x18, 0xf7,				// JR loop
+};
+
+
+static Z80ADDRESSBUS memory;
+static Z80ADDRESSBUS snapshot;
+static std::atomic<bool> done;
+
+
+
+static double Run(Z80 *cpu, int slices) {
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < slices; i++) {
+		cpu->ExecuteTStates(SHM_SLICE);
+	}
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / slices;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int snapshots = argc > 1 ? atoi(argv[1]) : SHM_SNAPSHOTS;
+	int failed = 0;
+
+	memcpy(memory, program, sizeof(program));
+	memory[0x8000] = 0x55;		// A page never written again
+
+	Z80 cpu;
+	cpu.memory = memory;
+	cpu.Reset();
+
+	double plain_ns = Run(&cpu, 20000);
+
+	Z80SharedState shm;
+	if (shm.Create("shmtest")) {
+		printf("Can't create the shared region\n");
+		return 1;
+	}
+	shm.Attach(&cpu);
+	double attached_ns = Run(&cpu, 20000);
+
+	Z80SharedState observer;
+	if (observer.Open(shm.GetFd())) {
+		printf("Can't open the shared region\n");
+		return 1;
+	}
+
+	// Emulation thread, never waits for the observer
+	done.store(false);
+	ZQWORD slices = 0;
+	std::thread emulation([&cpu, &slices]() {
+		while (!done.load(std::memory_order_relaxed)) {
+			cpu.ExecuteTStates(SHM_SLICE);
+			slices++;
+		}
+	});
+
+	int taken = 0, exhausted = 0, torn = 0;
+	for (int i = 0; i < snapshots; i++) {
+		Z80SHMREGISTERS regs;
+		if (observer.Snapshot(&regs, snapshot)) {
+			exhausted++;
+			continue;
+		}
+		taken++;
+
+		// A, then the low page, then the high one: each at most one behind
+		ZBYTE a = regs.af >> 8;
+		ZBYTE low = snapshot[SHM_LOW];
+		ZBYTE high = snapshot[SHM_HIGH];
+		if ((ZBYTE) (a - low) > 1 || (ZBYTE) (low - high) > 1 || (ZBYTE) (a - high) > 1 ||
+			snapshot[0x8000] != 0x55 || memcmp(snapshot, program, sizeof(program))) {
+			if (torn++ < 5) {
+				printf("Torn snapshot: A %02x, (4000) %02x, (C000) %02x, PC %04x\n", a, low, high, regs.pc);
+			}
+		}
+	}
+
+	done.store(true);
+	emulation.join();
+
+	// Quiet now, the last publication must match exactly
+	Z80SHMREGISTERS regs;
+	if (observer.Snapshot(&regs, snapshot) || memcmp(snapshot, memory, sizeof(memory))) {
+		printf("Final snapshot differs from the CPU\n");
+		failed++;
+	}
+
+	printf("%d snapshots over %llu slices: %d consistent, %d torn, %d ran out of retries\n",
+		snapshots, slices, taken - torn, torn, exhausted);
+	printf("Slice of %d T-states: %.0f ns, %.0f ns attached\n", SHM_SLICE, plain_ns, attached_ns);
+
+	if (torn || exhausted * 100 > snapshots) {
+		failed++;
+	}
+
+	// Both detach the CPU, which would publish into an unmapped block
+	shm.Close();
+	cpu.ExecuteTStates(SHM_SLICE);
+	{
+		Z80SharedState scoped;
+		scoped.Create("shmtest");
+		scoped.Attach(&cpu);
+		cpu.ExecuteTStates(SHM_SLICE);
+	}
+	cpu.ExecuteTStates(SHM_SLICE);
+	printf("FAILED: %d\n", failed);
+
+	return failed != 0;
+}
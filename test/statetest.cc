@@ -0,0 +1,109 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "z80.h"
+#include "zexfixture.h"
+
+
+// SaveState() / LoadState() round trips. zexdoc runs in slices of uneven
+// length, so most of them end with an instruction half done. At every
+// checkpoint the state is saved, the slice run, and then run again on a
+// second CPU restored from the save; both must end in the same state.
+// Then times a save and a load.
+// statetest [program.com] [checkpoints]
+
+
+#define STATE_CHECKPOINTS	20000
+#define STATE_TIMING		100000
+
+
+static Z80ADDRESSBUS memory, fork_memory;
+static Z80STATE saved, original, forked;
+
+
+
+int main(int argc, char *argv[]) {
+	const char *filename = argc > 1 ? argv[1] : "./test/zexdoc.com";
+	int checkpoints = argc > 2 ? atoi(argv[2]) : STATE_CHECKPOINTS;
+
+	if (!LoadZex(filename, memory)) {
+		return 1;
+	}
+
+	Z80 cpu, fork;
+	cpu.memory = memory;
+	fork.memory = fork_memory;
+	cpu.Reset();
+	cpu.IRQ();		// Never accepted, zexdoc runs with interrupts off, but saved with the rest
+	cpu.ClearIRQ();
+
+	int failed = 0;
+	unsigned int slice = 1;
+
+	for (int i = 0; i < checkpoints; i++) {
+		slice = (slice * 7 + 3) % 61 + 1;
+
+		cpu.SaveState(&saved);
+		cpu.ExecuteTStates(slice);
+		cpu.SaveState(&original);
+
+		// Knock the fork off step first, whatever LoadState() misses shows
+		fork.ExecuteTStates(i % 13 + 1);
+		if (fork.LoadState(&saved)) {
+			printf("LoadState() rejected a state from SaveState()\n");
+			return 1;
+		}
+		fork.ExecuteTStates(slice);
+		fork.SaveState(&forked);
+
+		if (memcmp(&original, &forked, sizeof(Z80STATE))) {
+			if (failed++ < 10) {
+				printf("Checkpoint %d (clock %llu, pc %04x): restored CPU diverged\n", i, saved.clock, saved.pc);
+			}
+		}
+	}
+
+	saved.version++;
+	if (fork.LoadState(&saved) == 0) {
+		printf("LoadState() took a state from another version\n");
+		failed++;
+	}
+	saved.version--;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < STATE_TIMING; i++) {
+		cpu.SaveState(&saved);
+	}
+	auto middle = std::chrono::steady_clock::now();
+	for (int i = 0; i < STATE_TIMING; i++) {
+		fork.LoadState(&saved);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	printf("Z80STATE %zu bytes\n", sizeof(Z80STATE));
+	printf("SaveState %.2f us, LoadState %.2f us\n",
+		std::chrono::duration<double, std::micro>(middle - start).count() / STATE_TIMING,
+		std::chrono::duration<double, std::micro>(end - middle).count() / STATE_TIMING);
+	printf("CHECKPOINTS: %d\nFAILED CHECKPOINTS: %d\n", checkpoints, failed);
+
+	return failed != 0;
+}
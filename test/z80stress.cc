@@ -0,0 +1,153 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "z80.h"
+
+
+// Construction / execution stress test, meant to be built with
+// -fsanitize=thread. Every thread keeps creating CPUs and running the same
+// program on its own memory; each run must end in the state a CPU built
+// and run alone on the main thread ends in.
+// z80stress [threads] [instances per thread]
+
+
+#define STRESS_THREADS		8
+#define STRESS_INSTANCES	200
+#define STRESS_TSTATES		20000
+
+
+typedef struct {
+	ZWORD af, bc, de, hl, ix, iy, sp, pc;
+	ZQWORD clock;
+	unsigned int checksum;
+} RESULT;
+
+
+// Loops over byte and pair registers, (IX+d) / (IY+d), CB and ED forms, so
+// that every operand kind the decode tables describe gets used
+static const ZBYTE program[] = {
+	0x31, 0x00, 0xf0,		// LD SP, 0xF000
+	0xdd, 0x21, 0x00, 0x80,	// LD IX, 0x8000
+	0xfd, 0x21, 0x00, 0x90,	// LD IY, 0x9000
+	0x01, 0x34, 0x12,		// LD BC, 0x1234
+	0x11, 0x78, 0x56,		// LD DE, 0x5678
+	0x21, 0x00, 0xa0,		// LD HL, 0xA000
+	// loop:
+	0x78,					// LD A, B
+	0x81,					// ADD A, C
+	0x47,					// LD B, A
+	0x4a,					// LD C, D
+	0x53,					// LD D, E
+	0x5c,					// LD E, H
+	0x65,					// LD H, L
+	0x6f,					// LD L, A
+	0xdd, 0x77, 0x05,		// LD (IX+5), A
+	0xfd, 0x70, 0xfe,		// LD (IY-2), B
+	0xdd, 0x86, 0x05,		// ADD A, (IX+5)
+	0xcb, 0x10,				// RL B
+	0xcb, 0x3b,				// SRL E
+	0xdd, 0xcb, 0x05, 0x06,	// RLC (IX+5)
+	0xed, 0x44,				// NEG
+	0xed, 0x4a,				// ADC HL, BC
+	0x77,					// LD (HL), A
+	0xc5,					// PUSH BC
+	0xe1,					// POP HL
+	0xdd, 0x23,				// INC IX
+	0xfd, 0x2b,				// DEC IY
+	0xc3, 0x14, 0x00,		// JP loop
+};
+
+
+
+// Friend of Z80 in __Z80TEST__ builds, for the registers
+class Z80Test {
+
+public:
+
+	static RESULT Run();
+};
+
+
+
+RESULT Z80Test::Run() {
+	static thread_local Z80ADDRESSBUS memory;
+	Z80 *cpu = new Z80();
+	RESULT result;
+
+	memset(&result, 0, sizeof(result));		// Padding too, results are memcmp()ed
+	memset(memory, 0, sizeof(memory));
+	memcpy(memory, program, sizeof(program));
+
+	cpu->memory = memory;
+	cpu->Reset();
+	cpu->ExecuteTStates(STRESS_TSTATES);
+
+	result.af = cpu->reg.w.af;
+	result.bc = cpu->reg.w.bc;
+	result.de = cpu->reg.w.de;
+	result.hl = cpu->reg.w.hl;
+	result.ix = cpu->reg.w.ix;
+	result.iy = cpu->reg.w.iy;
+	result.sp = cpu->reg.w.sp;
+	result.pc = cpu->pc;
+	result.clock = cpu->GetClock();
+	result.checksum = 0;
+	for (int i = 0; i < 0xffff + 1; i++) {
+		result.checksum = result.checksum * 31 + memory[i];
+	}
+
+	delete cpu;
+
+	return result;
+}
+
+
+
+int main(int argc, char *argv[]) {
+	int threads = argc > 1 ? atoi(argv[1]) : STRESS_THREADS;
+	int instances = argc > 2 ? atoi(argv[2]) : STRESS_INSTANCES;
+
+	RESULT expected = Z80Test::Run();
+	std::atomic<int> failed(0);
+	std::vector<std::thread> workers;
+
+	for (int t = 0; t < threads; t++) {
+		workers.push_back(std::thread([&]() {
+			for (int i = 0; i < instances; i++) {
+				RESULT result = Z80Test::Run();
+				if (memcmp(&result, &expected, sizeof(result)) != 0) {
+					failed++;
+				}
+			}
+		}));
+	}
+
+	for (auto &worker : workers) {
+		worker.join();
+	}
+
+	printf("INSTANCES: %d\nFAILED INSTANCES: %d\n", threads * instances, failed.load());
+
+	return failed.load();
+}
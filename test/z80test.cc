@@ -42,28 +42,35 @@ using namespace std;
 
 Z80Test::Z80Test() { }
 
-ZBYTE Z80Test::IOReadCallback(ZWORD addr) {
-	current_case->io.push_back(Z80Test::IOACCESS());
-	current_case->io.back().prpw = 0;
-	current_case->io.back().address = addr;
-	current_case->io.back().data = addr >> 8;
+ZBYTE Z80Test::IOReadCallback(WORKER *w, ZWORD addr) {
+	w->current_case->io.push_back(Z80Test::IOACCESS());
+	w->current_case->io.back().prpw = 0;
+	w->current_case->io.back().address = addr;
+	w->current_case->io.back().data = addr >> 8;
 	return addr >> 8;
 }
 
 
-void Z80Test::IOWriteCallback(ZWORD addr, ZBYTE data) {
-	current_case->io.push_back(Z80Test::IOACCESS());
-	current_case->io.back().prpw = 1;
-	current_case->io.back().address = addr;
-	current_case->io.back().data = data;
+void Z80Test::IOWriteCallback(WORKER *w, ZWORD addr, ZBYTE data) {
+	w->current_case->io.push_back(Z80Test::IOACCESS());
+	w->current_case->io.back().prpw = 1;
+	w->current_case->io.back().address = addr;
+	w->current_case->io.back().data = data;
 }
 
 
-void Z80Test::Init() {
-	emul = new Z80();
+void Z80Test::Init(unsigned int threads) {
 
-	emul->SetIOReadCallback(std::bind(&Z80Test::IOReadCallback, this, std::placeholders::_1));
-	emul->SetIOWriteCallback(std::bind(&Z80Test::IOWriteCallback, this, std::placeholders::_1, std::placeholders::_2));
+	// One emulator and one 64 KB memory per thread
+	for (unsigned int i = 0; i < threads; i++) {
+		WORKER *w = new WORKER();
+
+		w->emul = new Z80();
+		w->emul->SetIOReadCallback(std::bind(&Z80Test::IOReadCallback, this, w, std::placeholders::_1));
+		w->emul->SetIOWriteCallback(std::bind(&Z80Test::IOWriteCallback, this, w, std::placeholders::_1, std::placeholders::_2));
+
+		workers.push_back(w);
+	}
 
 	// FUSE Z80 test suite, with some added tests and modifyed for undocumented effects
 	cases_result = LoadTestCases("./test/tests.in");
@@ -71,21 +78,30 @@ void Z80Test::Init() {
 }
 
 
+// Cases are handed out one at a time, so a slow shard never holds the rest
+// back. Results go by case number and are reported in that order.
+
 int Z80Test::TestAll() {
-	int result;
-	unsigned int exec_tstates;
+	vector<char> results(cases_result.size(), 0);
+	atomic<unsigned int> next(0);
+	vector<thread> threads;
 
-	for (unsigned int i = 0; i < cases_result.size(); i++) {
+	for (unsigned int i = 1; i < workers.size(); i++) {
+		threads.push_back(thread(&Z80Test::RunShard, this, workers[i], &next, &results));
+	}
+	RunShard(workers[0], &next, &results);
 
-		Z80Test::current_case = &cases_result[i];
+	for (unsigned int i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
 
-		exec_tstates = SetupTest(i);
-			
-		emul->ExecuteTStates(exec_tstates);
 
-		result = CheckResult(i);
+	for (unsigned int i = 0; i < cases_result.size(); i++) {
+		if (!Selected(i)) {
+			continue;
+		}
 
-		if (result) {
+		if (results[i]) {
 			failed.push_back(i);
 			notpassed++;
 		} else {
@@ -93,9 +109,8 @@ int Z80Test::TestAll() {
 		}
 	}
 
-
 	for (unsigned int i = 0; i < failed.size(); i++) {
-		ShowFailed(failed[i]);
+		ShowFailed(workers[0], failed[i]);
 	}
 
 	cout << "PASSED TESTS: " << dec << passed << "\nFAILED TESTS: " << dec << notpassed << endl;
@@ -106,30 +121,67 @@ int Z80Test::TestAll() {
 
 
 
-int Z80Test::CheckResult(int pos) {
+void Z80Test::RunShard(WORKER *w, atomic<unsigned int> *next, vector<char> *results) {
+	unsigned int exec_tstates;
+
+	for (unsigned int i = (*next)++; i < cases_result.size(); i = (*next)++) {
+
+		if (!Selected(i)) {
+			continue;
+		}
+
+		w->current_case = &cases_result[i];
+
+		exec_tstates = SetupTest(w, i);
+
+		w->emul->ExecuteTStates(exec_tstates);
+
+		(*results)[i] = CheckResult(w, i);
+	}
+}
+
+
+
+bool Z80Test::Selected(int pos) {
+	if (prefixes.empty()) {
+		return true;
+	}
+
+	for (unsigned int i = 0; i < prefixes.size(); i++) {
+		if (cases_result[pos].testname.compare(0, prefixes[i].size(), prefixes[i]) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+int Z80Test::CheckResult(WORKER *w, int pos) {
 
-	if (emul->reg.w.af != 		cases_expected[pos].reg.w.af) return 1;
-	if (emul->reg.w.bc != 		cases_expected[pos].reg.w.bc) return 1;
-	if (emul->reg.w.de != 		cases_expected[pos].reg.w.de) return 1;
-	if (emul->reg.w.hl != 		cases_expected[pos].reg.w.hl) return 1;
-	if (emul->alt_reg.w.af != 	cases_expected[pos].alt_reg.w.af) return 1;
-	if (emul->alt_reg.w.bc != 	cases_expected[pos].alt_reg.w.bc) return 1;
-	if (emul->alt_reg.w.de != 	cases_expected[pos].alt_reg.w.de) return 1;
-	if (emul->alt_reg.w.hl != 	cases_expected[pos].alt_reg.w.hl) return 1;
-	if (emul->reg.w.ix != 		cases_expected[pos].reg.w.ix) return 1;
-	if (emul->reg.w.iy != 		cases_expected[pos].reg.w.iy) return 1;
-	if (emul->reg.w.sp != 		cases_expected[pos].reg.w.sp) return 1;
-	if (emul->pc != 			cases_expected[pos].pc) return 1;
-	if (emul->reg.b.i !=		cases_expected[pos].reg.b.i) return 1;
-	if (emul->reg.b.r !=		cases_expected[pos].reg.b.r) return 1;
-	if (emul->iff1 !=			cases_expected[pos].iff1) return 1;
-	if (emul->iff2 !=			cases_expected[pos].iff2) return 1;
-	if (emul->im !=				cases_expected[pos].im) return 1;
-	if (emul->halted !=			cases_expected[pos].halted) return 1;
+	if (w->emul->reg.w.af != 		cases_expected[pos].reg.w.af) return 1;
+	if (w->emul->reg.w.bc != 		cases_expected[pos].reg.w.bc) return 1;
+	if (w->emul->reg.w.de != 		cases_expected[pos].reg.w.de) return 1;
+	if (w->emul->reg.w.hl != 		cases_expected[pos].reg.w.hl) return 1;
+	if (w->emul->alt_reg.w.af != 	cases_expected[pos].alt_reg.w.af) return 1;
+	if (w->emul->alt_reg.w.bc != 	cases_expected[pos].alt_reg.w.bc) return 1;
+	if (w->emul->alt_reg.w.de != 	cases_expected[pos].alt_reg.w.de) return 1;
+	if (w->emul->alt_reg.w.hl != 	cases_expected[pos].alt_reg.w.hl) return 1;
+	if (w->emul->reg.w.ix != 		cases_expected[pos].reg.w.ix) return 1;
+	if (w->emul->reg.w.iy != 		cases_expected[pos].reg.w.iy) return 1;
+	if (w->emul->reg.w.sp != 		cases_expected[pos].reg.w.sp) return 1;
+	if (w->emul->pc != 			cases_expected[pos].pc) return 1;
+	if (w->emul->reg.b.i !=		cases_expected[pos].reg.b.i) return 1;
+	if (w->emul->reg.b.r !=		cases_expected[pos].reg.b.r) return 1;
+	if (w->emul->iff1 !=			cases_expected[pos].iff1) return 1;
+	if (w->emul->iff2 !=			cases_expected[pos].iff2) return 1;
+	if (w->emul->im !=				cases_expected[pos].im) return 1;
+	if (w->emul->isHalted() !=	cases_expected[pos].halted) return 1;
 
-	if (emul->tstates != 		cases_expected[pos].tstates) return 1;
+	if (w->emul->tstates != 		cases_expected[pos].tstates) return 1;
 
-	if (DiffMem(pos)) return 1;
+	if (DiffMem(w, pos)) return 1;
 
 	if (cases_result[pos].io.size() != cases_expected[pos].io.size()) {
 		return 1;
@@ -150,52 +202,52 @@ int Z80Test::CheckResult(int pos) {
 }
 
 
-int Z80Test::SetupTest(int pos) {
-		emul->memory = memory;
-
-		emul->Reset();
-		emul->reg.w.af = 		cases_result[pos].reg.w.af;
-		emul->reg.w.bc = 		cases_result[pos].reg.w.bc;
-		emul->reg.w.de = 		cases_result[pos].reg.w.de;
-		emul->reg.w.hl = 		cases_result[pos].reg.w.hl;
-		emul->alt_reg.w.af = 	cases_result[pos].alt_reg.w.af;
-		emul->alt_reg.w.bc = 	cases_result[pos].alt_reg.w.bc;
-		emul->alt_reg.w.de = 	cases_result[pos].alt_reg.w.de;
-		emul->alt_reg.w.hl = 	cases_result[pos].alt_reg.w.hl;
-		emul->reg.w.ix = 		cases_result[pos].reg.w.ix;
-		emul->reg.w.iy = 		cases_result[pos].reg.w.iy;
-		emul->reg.w.sp = 		cases_result[pos].reg.w.sp;
-		emul->reg.w.wz = 		0x0000;
-		emul->pc = 				cases_result[pos].pc;
-		emul->reg.b.i =			cases_result[pos].reg.b.i;
-		emul->reg.b.r =			cases_result[pos].reg.b.r;
-		emul->iff1 =			cases_result[pos].iff1;
-		emul->iff2 =			cases_result[pos].iff2;
-		emul->im =				cases_result[pos].im;
-		emul->halted =			cases_result[pos].halted;
-
-		FillMemory();
+int Z80Test::SetupTest(WORKER *w, int pos) {
+		w->emul->memory = w->memory;
+
+		w->emul->Reset();
+		w->emul->reg.w.af = 		cases_result[pos].reg.w.af;
+		w->emul->reg.w.bc = 		cases_result[pos].reg.w.bc;
+		w->emul->reg.w.de = 		cases_result[pos].reg.w.de;
+		w->emul->reg.w.hl = 		cases_result[pos].reg.w.hl;
+		w->emul->alt_reg.w.af = 	cases_result[pos].alt_reg.w.af;
+		w->emul->alt_reg.w.bc = 	cases_result[pos].alt_reg.w.bc;
+		w->emul->alt_reg.w.de = 	cases_result[pos].alt_reg.w.de;
+		w->emul->alt_reg.w.hl = 	cases_result[pos].alt_reg.w.hl;
+		w->emul->reg.w.ix = 		cases_result[pos].reg.w.ix;
+		w->emul->reg.w.iy = 		cases_result[pos].reg.w.iy;
+		w->emul->reg.w.sp = 		cases_result[pos].reg.w.sp;
+		w->emul->reg.w.wz = 		0x0000;
+		w->emul->pc = 				cases_result[pos].pc;
+		w->emul->reg.b.i =			cases_result[pos].reg.b.i;
+		w->emul->reg.b.r =			cases_result[pos].reg.b.r;
+		w->emul->iff1 =			cases_result[pos].iff1;
+		w->emul->iff2 =			cases_result[pos].iff2;
+		w->emul->im =				cases_result[pos].im;
+		w->emul->events =			cases_result[pos].halted ? Z80EVENT_HALT : 0;
+
+		FillMemory(w);
 		for (unsigned int j = 0; j < cases_result[pos].mem.size(); j++) {
 			for (unsigned int k = 0; k < cases_result[pos].mem[j].data.size(); k++) {
-				memory[cases_result[pos].mem[j].address + k] = cases_result[pos].mem[j].data[k];
+				w->memory[cases_result[pos].mem[j].address + k] = cases_result[pos].mem[j].data[k];
 			}
 		}
-		memcpy(initial_memory, memory, 0xffff + 1);
+		memcpy(w->initial_memory, w->memory, 0xffff + 1);
 
 		return cases_expected[pos].tstates;
 }
 
 
-int Z80Test::DiffMem(int pos) {
+int Z80Test::DiffMem(WORKER *w, int pos) {
 
 	for (unsigned int i = 0; i < cases_expected[pos].mem.size(); i++) {
 		for (unsigned int j = 0; j < cases_expected[pos].mem[i].data.size(); j++) {
-			initial_memory[cases_expected[pos].mem[i].address + j] = cases_expected[pos].mem[i].data[j];
+			w->initial_memory[cases_expected[pos].mem[i].address + j] = cases_expected[pos].mem[i].data[j];
 		}
 	}
 
 	for (unsigned int i = 0; i < 0xffff + 1; i++) {
-		if (memory[i] != initial_memory[i]) {
+		if (w->memory[i] != w->initial_memory[i]) {
 			return 1;
 		}
 	}
@@ -205,18 +257,19 @@ int Z80Test::DiffMem(int pos) {
 
 
 
-void Z80Test::ShowFailed(int pos) {
+void Z80Test::ShowFailed(WORKER *w, int pos) {
 
 	unsigned int exec_tstates;
 	ZBYTE emul_flags, expect_flags;
 
-	exec_tstates = SetupTest(pos);
+	w->current_case = &cases_result[pos];
+	exec_tstates = SetupTest(w, pos);
 
-	while (emul->tstates < exec_tstates) {
-		emul->ExecuteTStates(exec_tstates);
+	while (w->emul->tstates < exec_tstates) {
+		w->emul->ExecuteTStates(exec_tstates);
 	}
 
-	emul_flags = (((emul->reg.w.af << 8) >> 8)& 0x00ff);
+	emul_flags = (((w->emul->reg.w.af << 8) >> 8)& 0x00ff);
 	expect_flags = (((cases_expected[pos].reg.w.af << 8) >> 8) & 0x00ff);
 
 	cout	<< "TESTING OPCODE: ";
@@ -246,12 +299,12 @@ void Z80Test::ShowFailed(int pos) {
 	cout	<< "     PC    SP    AF    BC    DE    HL    AF'   BC'   DE'   HL'   IX    IY" << endl;
 	cout	<< "   ------------------------------------------------------------------------" << endl;
 	cout	<< internal << setfill('0');
-	cout	<< "T | " << hex << setw(4) << emul->pc << "  " << setw(4) << emul->reg.w.sp
-			<< "  " << setw(4) << emul->reg.w.af << "  " << setw(4) << emul->reg.w.bc
-			<< "  " << setw(4) << emul->reg.w.de << "  " << setw(4) << emul->reg.w.hl
-			<< "  " << setw(4) << emul->alt_reg.w.af << "  " << setw(4) << emul->alt_reg.w.bc
-			<< "  " << setw(4) << emul->alt_reg.w.de << "  " << setw(4) << emul->alt_reg.w.hl
-			<< "  " << setw(4) << emul->reg.w.ix << "  " << setw(4) << emul->reg.w.iy << " |" << endl;
+	cout	<< "T | " << hex << setw(4) << w->emul->pc << "  " << setw(4) << w->emul->reg.w.sp
+			<< "  " << setw(4) << w->emul->reg.w.af << "  " << setw(4) << w->emul->reg.w.bc
+			<< "  " << setw(4) << w->emul->reg.w.de << "  " << setw(4) << w->emul->reg.w.hl
+			<< "  " << setw(4) << w->emul->alt_reg.w.af << "  " << setw(4) << w->emul->alt_reg.w.bc
+			<< "  " << setw(4) << w->emul->alt_reg.w.de << "  " << setw(4) << w->emul->alt_reg.w.hl
+			<< "  " << setw(4) << w->emul->reg.w.ix << "  " << setw(4) << w->emul->reg.w.iy << " |" << endl;
 	cout	<< "E | " << hex << setw(4) << cases_expected[pos].pc << "  " << setw(4) << cases_expected[pos].reg.w.sp
 			<< "  " << setw(4) << cases_expected[pos].reg.w.af << "  " << setw(4) << cases_expected[pos].reg.w.bc
 			<< "  " << setw(4) << cases_expected[pos].reg.w.de << "  " << setw(4) << cases_expected[pos].reg.w.hl
@@ -262,11 +315,11 @@ void Z80Test::ShowFailed(int pos) {
 	cout	<< "    I   R   IFF1 IFF2  IM  halted  tstates    " << endl;
 	cout	<< "   ----------------------------------------" << endl;
 	cout	<< internal << setfill('0');
-	cout	<< "T | " << hex << setw(2) << (int) emul->reg.b.i << "  " << setw(2) << (int) emul->reg.b.r
-			<< "  " << dec << emul->iff1 << "    " << dec << emul->iff2
-			<< "     " << dec << emul->im << "     " << emul->halted;
+	cout	<< "T | " << hex << setw(2) << (int) w->emul->reg.b.i << "  " << setw(2) << (int) w->emul->reg.b.r
+			<< "  " << dec << w->emul->iff1 << "    " << dec << w->emul->iff2
+			<< "     " << dec << w->emul->im << "     " << w->emul->isHalted();
 	cout	<< internal << setfill(' ');				
-	cout	<< "       "  << setw(4) << dec << emul->tstates << "  |" << endl;
+	cout	<< "       "  << setw(4) << dec << w->emul->tstates << "  |" << endl;
 	cout	<< internal << setfill('0');				
 	cout	<< "E | " << hex << setw(2) << (int) cases_expected[pos].reg.b.i << "  " << setw(2) << (int) cases_expected[pos].reg.b.r
 			<< "  " << dec << cases_expected[pos].iff1 << "    " << dec << cases_expected[pos].iff2
@@ -277,20 +330,20 @@ void Z80Test::ShowFailed(int pos) {
 
 	for (unsigned int i = 0; i < cases_expected[pos].mem.size(); i++) {
 		for (unsigned int j = 0; j < cases_expected[pos].mem[i].data.size(); j++) {
-			initial_memory[cases_expected[pos].mem[i].address + j] = cases_expected[pos].mem[i].data[j];
+			w->initial_memory[cases_expected[pos].mem[i].address + j] = cases_expected[pos].mem[i].data[j];
 		}
 	}
 
 	int first = 1;
 	for (unsigned int i = 0; i < 0xffff + 1; i++) {
-		if (memory[i] != initial_memory[i]) {
+		if (w->memory[i] != w->initial_memory[i]) {
 			if (first) {
 				cout << "Address   T   E" << endl;
 				cout << "----------------" << endl;
 				first = 0;
 			}
 			cout << internal << setfill('0');
-			cout << setw(4) << hex << i << "      " << setw(2) << hex << (ZWORD) memory[i] << "  " << setw(2) << hex << (ZWORD) initial_memory[i] << endl;
+			cout << setw(4) << hex << i << "      " << setw(2) << hex << (ZWORD) w->memory[i] << "  " << setw(2) << hex << (ZWORD) w->initial_memory[i] << endl;
 		}
 	} 
 
@@ -318,7 +371,7 @@ vector<Z80Test::TESTCASE> Z80Test::LoadTestCases(string file) {
 	int cnt = 0;
 	int addr = 0;
 	int databyte;
-	char iomode[2];
+	char iomode[3];
 
 	while(!tests.eof()) {
 			 
@@ -375,22 +428,38 @@ vector<Z80Test::TESTCASE> Z80Test::LoadTestCases(string file) {
 
 
 
-void Z80Test::FillMemory() {
+void Z80Test::FillMemory(WORKER *w) {
 		  
 	for (int i = 0; i < 0xffff + 1; i += 4) {
-		memory[i] = 	0xde; 
-		memory[i + 1] = 0xad;
-		memory[i + 2] = 0xbe; 
-		memory[i + 3] = 0xef;
+		w->memory[i] = 	0xde; 
+		w->memory[i + 1] = 0xad;
+		w->memory[i + 2] = 0xbe; 
+		w->memory[i + 3] = 0xef;
 	}
 }
 
 
 
-int main() {
+// z80test [-j threads] [prefix ...]
+// Prefixes match the start of the case name, e.g. "ed" or "ddcb".
+
+int main(int argc, char *argv[]) {
 
 	Z80Test *test = new Z80Test();
-	test->Init();
+	unsigned int threads = thread::hardware_concurrency();
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else {
+			test->prefixes.push_back(argv[i]);
+		}
+	}
+	if (threads == 0) {
+		threads = 1;
+	}
+
+	test->Init(threads);
 
 	return test->TestAll();
 
@@ -16,11 +16,14 @@
  
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <iostream> // Using iostream just for fun
 #include <fstream>
 #include <iomanip>
 #include <vector>
+#include <atomic>
+#include <thread>
 
 #include "z80.h"
 
@@ -59,15 +62,19 @@ public:
 	} TESTCASE;
 
 
-	vector<TESTCASE> cases_result;
-	vector<TESTCASE> cases_expected;
-
-	TESTCASE *current_case;
+	// Everything a thread needs to run cases on its own
+	typedef struct WORKER {
+		Z80 *emul;
+		TESTCASE *current_case;
+		Z80ADDRESSBUS initial_memory, memory;
+	} WORKER;
 
-	Z80ADDRESSBUS initial_memory, memory;
 
+	vector<TESTCASE> cases_result;
+	vector<TESTCASE> cases_expected;
 
-	Z80 *emul;
+	vector<WORKER *> workers;
+	vector<string> prefixes;		// Run only cases whose name starts with one of these
 
 	int passed = 0;
 	int notpassed = 0;
@@ -76,16 +83,18 @@ public:
 
 	Z80Test();
 
-	void Init();
+	void Init(unsigned int threads);
 
 	int TestAll();
-	int CheckResult(int pos);
-	int SetupTest(int pos);
-	int DiffMem(int pos);
-	void ShowFailed(int pos);
+	void RunShard(WORKER *w, atomic<unsigned int> *next, vector<char> *results);
+	bool Selected(int pos);
+	int CheckResult(WORKER *w, int pos);
+	int SetupTest(WORKER *w, int pos);
+	int DiffMem(WORKER *w, int pos);
+	void ShowFailed(WORKER *w, int pos);
 	vector<TESTCASE> LoadTestCases(string file);
-	void FillMemory();
-	ZBYTE IOReadCallback(ZWORD addr);
-	void IOWriteCallback(ZWORD addr, ZBYTE data);
+	void FillMemory(WORKER *w);
+	ZBYTE IOReadCallback(WORKER *w, ZWORD addr);
+	void IOWriteCallback(WORKER *w, ZWORD addr, ZBYTE data);
 
 };
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ZEX_FIXTURE_H_
+#define ZEX_FIXTURE_H_
+
+#include <stdio.h>
+#include <string.h>
+
+#include "z80.h"
+
+
+// Loads a CP/M program, zexdoc in the tests, at 0x100 into a cleared 64 KB
+// memory, with a JP 0x100 at 0000, BDOS calls at 0005 just returning and the
+// top of the TPA, where zexdoc sets SP, at F000. Says why and returns false
+// if the program can't be read.
+
+static bool LoadZex(const char *filename, ZBYTE *memory) {
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL) {
+		printf("Can't open %s\n", filename);
+		return false;
+	}
+	memset(memory, 0, sizeof(Z80ADDRESSBUS));
+	size_t loaded = fread(&memory[0x100], 1, sizeof(Z80ADDRESSBUS) - 0x100, file);
+	fclose(file);
+	if (loaded == 0) {
+		printf("Empty program %s\n", filename);
+		return false;
+	}
+
+	memory[0x0000] = 0xc3;		// JP 0x100
+	memory[0x0001] = 0x00;
+	memory[0x0002] = 0x01;
+	memory[0x0005] = 0xc9;		// BDOS calls just return
+	memory[0x0006] = 0x00;		// Top of the TPA
+	memory[0x0007] = 0xf0;
+
+	return true;
+}
+
+#endif
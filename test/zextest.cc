@@ -26,27 +26,85 @@
 
 Z80Test::Z80Test() { }
 
-Z80Test::~Z80Test() {
-	delete cpu;
-}
+Z80Test::~Z80Test() { }
 
-void Z80Test::Init() {
-	cpu = new Z80();
-	cpu->memory = memory;
-	cpu->SetIOReadCallback(std::bind(&Z80Test::IOReadCallback, this, std::placeholders::_1));
-	cpu->SetIOWriteCallback(std::bind(&Z80Test::IOWriteCallback, this, std::placeholders::_1, std::placeholders::_2));
+void Z80Test::Init(unsigned int threads) {
+	this->threads = threads ? threads : 1;
 }
 
 
 
+// The exercisers walk a zero-terminated table of test groups. Each group is
+// run on its own CPU from a copy of the program whose table holds only that
+// group, on as many threads as asked. The report is put back together in
+// table order: the banner from the first run, the lines of every group,
+// then the closing message from the last run.
+
 void Z80Test::Emulate(char *filename) {
+	double		  total;
+
+	Load(filename);
+
+	ZWORD tests = FindTests();
+	std::vector<GROUP *> groups;
+
+	for (ZWORD entry = tests; image[entry] | image[entry + 1]; entry += 2) {
+		groups.push_back(new GROUP());
+	}
+
+	std::atomic<unsigned int> next(0);
+	std::vector<std::thread> workers;
+
+	for (unsigned int i = 1; i < threads; i++) {
+		workers.push_back(std::thread(&Z80Test::RunGroups, this, &groups, tests, &next));
+	}
+	RunGroups(&groups, tests, &next);
+
+	for (unsigned int i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+
+
+	// The start-up code runs once per group, so this is a bit more than a
+	// single serial run
+	total = 0.0;
+
+	for (unsigned int i = 0; i < groups.size(); i++) {
+		std::vector<std::string> &output = groups[i]->output;
+
+		for (unsigned int j = 0; j < output.size(); j++) {
+			bool banner = j == 0;
+			bool closing = j == output.size() - 1;
+
+			if ((!banner || i == 0) && (!closing || i == groups.size() - 1)) {
+				printf("%s", output[j].c_str());
+			}
+		}
+
+		total += groups[i]->total;
+
+		delete groups[i]->cpu;
+		delete groups[i];
+	}
+
+
+	printf("\n%.0f cycle(s) emulated.\n" 
+				"For a Z80 running at %.2fMHz, "
+				"that would be %d second(s) or %.2f hour(s).\n",
+				total,
+				Z80_CPU_SPEED / 1000000.0,
+				(int) (total / Z80_CPU_SPEED),
+				total / ((double) 3600 * Z80_CPU_SPEED));
+}
+
+
+
+void Z80Test::Load(char *filename) {
 	FILE			*file;
 	long			l;
-	
-	double		  total;
 
 	for (int i = 0; i < 0xffff + 1; i++) {
-		cpu->memory[i] = 0x00; 
+		image[i] = 0x00; 
 	}
 
 	if ((file = fopen(filename, "rb")) == NULL) {
@@ -58,67 +116,106 @@ void Z80Test::Emulate(char *filename) {
 	l = ftell(file);
 
 	fseek(file, 0, SEEK_SET);
-	fread(memory + 0x100, 1, l, file);
+	if (fread(image + 0x100, 1, l, file) != (size_t) l) {
+		fprintf(stderr, "Can't read file!\n");
+		exit(1);
+	}
 
 	fclose(file);
 
 
-	cpu->Reset();
+	image[0] = 0xd3; // OUT N, A
+	image[1] = 0x00;
 
-	memory[0] = 0xd3; // OUT N, A
-	memory[1] = 0x00;
+	image[5] = 0xdb; // IN A, N
+	image[6] = 0x00;
+	image[7] = 0xc9; // RET
+}
 
-	memory[5] = 0xdb; // IN A, N
-	memory[6] = 0x00;
-	memory[7] = 0xc9; // RET
 
-	cpu->pc = 0x100;
-		
-	total = 0.0;
-		
+
+// Address of the group table, from the "ld hl,tests" that starts the main
+// loop (ld hl,nn / ld a,(hl) / inc hl / or (hl))
+
+ZWORD Z80Test::FindTests() {
+	for (int i = 0x100; i < 0x200; i++) {
+		if (image[i] == 0x21 && image[i + 3] == 0x7e && image[i + 4] == 0x23 && image[i + 5] == 0xb6) {
+			return image[i + 1] | (image[i + 2] << 8);
+		}
+	}
+
+	fprintf(stderr, "Test table not found!\n");
+	exit(1);
+}
+
+
+
+void Z80Test::RunGroups(std::vector<GROUP *> *groups, ZWORD tests, std::atomic<unsigned int> *next) {
+	for (unsigned int n = (*next)++; n < groups->size(); n = (*next)++) {
+		RunGroup((*groups)[n], tests, n);
+	}
+}
+
+
+
+void Z80Test::RunGroup(GROUP *group, ZWORD tests, unsigned int n) {
+
+	memcpy(group->memory, image, sizeof(image));
+
+	// Group n moves to the head of the table, followed by the terminator
+	ZWORD entry = tests + n * 2;
+	group->memory[tests] = image[entry];
+	group->memory[tests + 1] = image[entry + 1];
+	group->memory[tests + 2] = 0x00;
+	group->memory[tests + 3] = 0x00;
+
+	group->cpu = new Z80();
+	group->cpu->memory = group->memory;
+	group->cpu->SetIOReadCallback(std::bind(&Z80Test::IOReadCallback, this, group, std::placeholders::_1));
+	group->cpu->SetIOWriteCallback(std::bind(&Z80Test::IOWriteCallback, this, group, std::placeholders::_1, std::placeholders::_2));
+
+	group->cpu->Reset();
+	group->cpu->pc = 0x100;
+
+	group->total = 0.0;
 	
 	while (1) {
-		total += cpu->ExecuteMCycle();
+		group->total += group->cpu->ExecuteMCycle();
 	
-		if (cpu->isHalted() != 0) {
+		if (group->cpu->isHalted() != 0) {
 			break;
 		}
 	}
-
-
-	printf("\n%.0f cycle(s) emulated.\n" 
-				"For a Z80 running at %.2fMHz, "
-				"that would be %d second(s) or %.2f hour(s).\n",
-				total,
-				Z80_CPU_SPEED / 1000000.0,
-				(int) (total / Z80_CPU_SPEED),
-				total / ((double) 3600 * Z80_CPU_SPEED));
 }
 
 
 
 
-ZBYTE Z80Test::IOReadCallback(ZWORD addr) {
-	SystemCall();
+ZBYTE Z80Test::IOReadCallback(GROUP *group, ZWORD addr) {
+	SystemCall(group);
 	return addr << 8;
 }
 	
-void Z80Test::IOWriteCallback(ZWORD addr, ZBYTE data) {
-	SystemCall();
-	cpu->halted = 1;
+// Warm boot, the program is done
+void Z80Test::IOWriteCallback(GROUP *group, ZWORD addr, ZBYTE data) {
+	group->cpu->events |= Z80EVENT_HALT;
 }
 
 // Emulate CP/M bdos call 5 functions 2 (output character on screen) and 9
-// (output $-terminated string to screen).
+// (output $-terminated string to screen). Output is kept, not printed, so
+// groups running at the same time don't mix.
+
+void Z80Test::SystemCall(GROUP *group) {
+	Z80 *cpu = group->cpu;
+	std::string text;
 
-void Z80Test::SystemCall() {
 	if (cpu->reg.b.c == 2) {
-		printf("%c", cpu->reg.b.e);
+		text += (char) cpu->reg.b.e;
 	} else if (cpu->reg.b.c == 9) {
 		int	 i, c;
 
-		for (i = cpu->reg.w.de, c = 0; memory[i] != '$'; i++) {
-			printf("%c", memory[i & 0xffff]);
+		for (i = cpu->reg.w.de, c = 0; group->memory[i & 0xffff] != '$'; i++) {
+			text += (char) group->memory[i & 0xffff];
 				if (c++ > MAXIMUM_STRING_LENGTH) {
 					fprintf(stderr,	"String to print is too long!\n");
 					exit(1);
@@ -126,14 +223,23 @@ void Z80Test::SystemCall() {
 		}
 
 	}
+
+	group->output.push_back(text);
 }
 
 
-int main (void) {
+// zextest [-j threads], one thread per core by default
+
+int main (int argc, char *argv[]) {
 
 	Z80Test *test = new Z80Test();
+	unsigned int threads = std::thread::hardware_concurrency();
+
+	if (argc > 2 && strcmp(argv[1], "-j") == 0) {
+		threads = atoi(argv[2]);
+	}
 
-	test->Init();
+	test->Init(threads);
 
 	printf("Testing documented instructions and effects (zexdoc.com)\n");
 	test->Emulate((char *) "./test/zexdoc.com");
@@ -142,4 +248,4 @@ int main (void) {
 	test->Emulate((char *) "./test/zexall.com");
 		
 	return 0;
-}
\ No newline at end of file
+}
@@ -17,25 +17,44 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 #include "z80.h"
 
 
 class Z80Test {
 
 public:
-	Z80 *cpu;
-	Z80ADDRESSBUS memory;
+
+	// One test group running on its own CPU and memory
+	typedef struct GROUP {
+		Z80 *cpu;
+		Z80ADDRESSBUS memory;
+		std::vector<std::string> output;	// One entry per BDOS call
+		double total;
+	} GROUP;
+
+	Z80ADDRESSBUS image;
+	unsigned int threads;
 
 	Z80Test();
 	~Z80Test();
 
 	void Emulate(char filename[256]);
-	void Init();
+	void Init(unsigned int threads);
 
 private:
-	ZBYTE IOReadCallback(ZWORD addr);
-	void IOWriteCallback(ZWORD addr, ZBYTE data);
+	void Load(char *filename);
+	ZWORD FindTests();
+	void RunGroups(std::vector<GROUP *> *groups, ZWORD tests, std::atomic<unsigned int> *next);
+	void RunGroup(GROUP *group, ZWORD tests, unsigned int n);
+
+	ZBYTE IOReadCallback(GROUP *group, ZWORD addr);
+	void IOWriteCallback(GROUP *group, ZWORD addr, ZBYTE data);
 
-	void SystemCall();
+	void SystemCall(GROUP *group);
 	
-};
\ No newline at end of file
+};
@@ -9,8 +9,28 @@ TODO: Fix tstates on ED table mirrored instructions
 
 import json
 import re
+import sys
 from collections import OrderedDict
 
+
+LICENSE = '''/*
+ * Nostalgic Z80 emulator
+ * Copyright (c) 2016, Antonio Rodriguez <@MoebiuZ>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+'''
+
 spec_reg = [ "I", "R" ]
 byte_reg = [ "A", "B", "C", "D", "E", "F", "H", "L", "IXH", "IXL", "IYH", "IYL", "I", "R" , "A'", "F'", "B'", "C'", "D'", "E'" ]
 word_reg = [ "DE", "HL", "AF", "AF'", "BC", "IY", "IX", "SP" ]
@@ -50,13 +70,68 @@ already = []
 
 pointer_tables = []
 operand_tables = []
-endian_tables = []
 
 
 sorted_declarations = []
 sorted_functions = []
 
 switch_tables = []
+gap_tables = []
+
+
+
+# Internal (non bus) T-states before each bus access of an instruction body,
+# counted after the opcode fetches, and after the displacement and opcode
+# reads of DDCB / FDCB. Taken from the M-cycle breakdown of each instruction,
+# anything not listed has its bus cycles back to back.
+
+body_gaps = {
+	"DJNZ":			[1],			# 5 T-state M1
+	"PUSH":			[1, 0],
+	"RST":			[1, 0],
+	"RET_cond":		[1, 0],
+	"CALL":			[0, 0, 1, 0],	# 4 T-state read of the high address byte
+	"CALL_cond":	[0, 0, 1, 0],
+	"EX_SP_RR":		[0, 0, 1, 0],
+	"INC_ind":		[0, 1],			# 4 T-state read
+	"DEC_ind":		[0, 1],
+	"RLD":			[0, 4],
+	"RRD":			[0, 4],
+	"INI":			[1, 0],			# 5 T-state second M1
+	"IND":			[1, 0],
+	"INIR":			[1, 0],
+	"INDR":			[1, 0],
+	"OUTI":			[1, 0],
+	"OUTD":			[1, 0],
+	"OTIR":			[1, 0],
+	"OTDR":			[1, 0],
+	"LD_off_n":		[0, 0, 2],		# 5 T-state n read
+	"INC_off":		[0, 5, 1],		# 5 internal T-states adding d
+	"DEC_off":		[0, 5, 1],
+}
+
+
+def bus_gaps(t, fnc_name):
+	if fnc_name in body_gaps:
+		gaps = body_gaps[fnc_name]
+
+	elif t == "CB_INSTRUCTIONS" and fnc_name.endswith("_HL"):
+		gaps = [0] if fnc_name.startswith("BIT") else [0, 1]
+
+	elif t == "DDCB_INSTRUCTIONS" or t == "FDCB_INSTRUCTIONS":
+		gaps = [2] if fnc_name.startswith("BIT") else [2, 1]
+
+	elif fnc_name.endswith("_off") or fnc_name.endswith("_off_R"):
+		gaps = [0, 5]
+
+	else:
+		gaps = []
+
+	word = 0
+	for k in range(0, len(gaps)):
+		word |= gaps[k] << (4 * k)
+
+	return "0x%04x" % word
 
 
 
@@ -68,20 +143,22 @@ with open('instructions.json') as data_file:
 
 def looparray(t):
 
-	endianess_fix = []
-
 	switchs = "void Z80::" + re.sub("_instructions",u"_switch",str(t).lower()) + "() {\n"
 	switchs += "\tswitch (op) {\n"
 
-	pointers = "\tconst OPCODES " + str(t).lower() + "[256] = {\n"
+	pointers = "const Z80::OPCODES Z80::" + str(t).lower() + "[256] = {"
+	gaps = "\t{"
 	#operands = "\tOPERANDS " + re.sub("instructions", ur"operands", str(t).lower()) + "[0xff + 1] {"
 
-	operands = "{ "
+	operands = "\t{"
 	for i in range(0, 256):
 		if i % 8 == 0:
 			pointers += "\n\t\t"
 			operands += "\n\t\t"
 
+		if i % 16 == 0:
+			gaps += "\n\t\t"
+
 		inst = re.split(" |,|->", data[t][i]["mnemonic"])
 
 		pointers += "&Z80::"
@@ -729,6 +806,7 @@ def looparray(t):
 
 
 		pointers += fnc_name
+		gaps += bus_gaps(t, fnc_name) + ","
 
 		if fnc_name not in already:
 			already.append(fnc_name)
@@ -742,23 +820,19 @@ def looparray(t):
 		
 
 		
-		tmp = 0
-		
+		# Byte register operands index the register file, whose pairs are in
+		# host byte order, so the table wraps them in HOST()
 
 		for j in range(1,4):
-			
-			if len(inst) >= j + 1 and inst[0] != "---":
 
-				operands += str(ops[str(inst[j])]) + ","
+			if len(inst) >= j + 1 and inst[0] != "---":
 				if inst[j] in byte_reg:
-					if inst[0] != "DJNZ" and inst[0] != "LDDR" and inst[0] != "LDIR" and inst[0] != "CPDR" and inst[0] != "CPIR" and inst[0] != "INDR" and inst[0] != "INIR" and  inst[0] != "OTDR" or inst[0] != "OTIR" and inst[0] != "JR" and inst[0] != "CALL" and inst[0] != "RET":
-						tmp |= 1 << (j - 1)
-					
+					operands += "HOST(" + str(ops[str(inst[j])]) + "),"
+				else:
+					operands += str(ops[str(inst[j])]) + ","
+
 			else:
 				operands += "0,"
-
-
-		endianess_fix.append(tmp)
 		
 
 
@@ -890,12 +964,13 @@ def looparray(t):
 			pointers += " "
 			operands += " "
 
-	pointers += "};\n\n"
-	operands += "},\n"
+	pointers += "};"
+	operands += "}"
+	gaps = gaps.rstrip(",") + " }"
 
 	pointer_tables.append(pointers)
 	operand_tables.append(operands)
-	endian_tables.append(endianess_fix)
+	gap_tables.append(gaps)
 	switchs += "\t}\n}"
 	switch_tables.append(switchs)
 
@@ -910,44 +985,89 @@ looparray('FD_INSTRUCTIONS')
 looparray('DDCB_INSTRUCTIONS')
 looparray('FDCB_INSTRUCTIONS')
 
-for item in pointer_tables:
-	print item
-
-print "\n\n"
-
-print "ARGUMENT_SETS a_set[7] = {"
-for item in operand_tables:
-	print item
 
-print "};"
 
-print "\n\n"
 
+# Flag tables, S, Z, the undocumented 5 and 3 bits and parity of each byte
 
-for item in sorted(sorted_declarations):
-	print item
-
-print "\n\n"
+def parity(n):
+	return 1 - bin(n).count("1") % 2
 
-for item in sorted(sorted_functions):
-	print item + "\n"
+def sz(n):
+	return (n & 0xa8) | (0x40 if n == 0 else 0)
 
+def table(values, per_line):
+	lines = []
+	for i in range(0, len(values), per_line):
+		lines.append("\t\t" + ", ".join(values[i:i + per_line]))
+	return ",\n".join(lines) + " };"
 
-fix = "BYTE endianess_fix[256 * 7] = {"
-#for item in endianess_fix:
-for i in range(0, len(endian_tables)):
-	for j in range (0, 256):
-		if j % 32 == 0:
-			fix += "\n\t\t"
 
-		fix += str(endian_tables[i][j]) + ","
-	fix += "\n"
 
-fix += "\n};"
-print fix
+# "python tables.py > ../src/z80tables.cc" regenerates the tables, "python
+# tables.py stubs" prints the handler declarations, empty bodies and
+# switches the tables were first written from
 
+if len(sys.argv) > 1 and sys.argv[1] == "stubs":
+	for item in sorted(sorted_declarations):
+		print item
 
-
-for item in switch_tables:
 	print "\n\n"
-	print item
\ No newline at end of file
+
+	for item in sorted(sorted_functions):
+		print item + "\n"
+
+	for item in switch_tables:
+		print "\n\n"
+		print item
+
+	sys.exit(0)
+
+
+print LICENSE
+print "#include \"z80.h\""
+print "\n"
+print "const ZBYTE Z80::parity[256] = {"
+print table([str(parity(n)) for n in range(256)], 16)
+print "\n"
+print "const ZBYTE Z80::SZ_table[256] = {"
+print table(["0x%02x" % sz(n) for n in range(256)], 8)
+print "\n"
+print "const ZBYTE Z80::SZP_table[256] = {"
+print table(["0x%02x" % (sz(n) | parity(n) << 2) for n in range(256)], 8)
+print "\n"
+print "const int Z80::V_table[4] = { 0, 4, 4, 0, };"
+print "\n"
+print "\n\n\n".join(pointer_tables)
+print ""
+print "const Z80::OPCODES *const Z80::instruction_tables[7] = {"
+print "\tmain_instructions, cb_instructions, ed_instructions, dd_instructions,"
+print "\tfd_instructions, ddcb_instructions, fdcb_instructions"
+print "};"
+print "\n"
+print "// Byte register operands index Z80REGISTERS::registers[], where each pair"
+print "// is stored in host byte order, so the two halves swap on little endian."
+print ""
+print "#ifdef _Z80_BIG_ENDIAN_"
+print "#define HOST(n)\t\t(n)"
+print "#else"
+print "#define HOST(n)\t\t((n) ^ 1)"
+print "#endif"
+print "\n"
+print "// Operands, then T-states / M-cycles taken and not taken, last M-cycle"
+print "// T-states taken and not taken, and the kind of jump check. One set per"
+print "// prefix: none, CB, ED, DD, FD, DDCB, FDCB."
+print ""
+print "const Z80::ARGUMENT_SETS Z80::a_set[7] = {"
+print ",\n".join(operand_tables) + " };"
+print ""
+print "#undef HOST"
+print "\n\n"
+print "// Internal T-states before each bus access of an instruction body, one nibble"
+print "// per access from the low one, see util/tables.py"
+print "#ifdef __Z80BUSTIMING__"
+print ""
+print "const ZWORD Z80::bus_gap_table[7][256] = {"
+print ",\n".join(gap_tables) + " };"
+print ""
+print "#endif"